@@ -0,0 +1,505 @@
+#include "distributed.h"
+
+#ifdef _WIN32
+
+Cluster *start_cluster(Board *board, int tile_rows, int tile_cols) {
+  printf("Error: distributed mode is not available on Windows\n");
+  return NULL;
+}
+
+int cluster_step(Cluster *cluster, Board *board, int generations,
+                 int keep_history) {
+  return -1;
+}
+
+void stop_cluster(Cluster *cluster) {}
+
+#else
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+// Commandes envoyées par le coordinateur à un worker
+typedef enum { CMD_LOAD, CMD_STEP, CMD_GATHER, CMD_QUIT } ClusterCommand;
+
+typedef struct {
+  int command;
+  int value;
+} ClusterMessage;
+
+// Voisins d'une tuile (-1 si la tuile touche le bord du plateau)
+typedef struct {
+  int coordinator;
+  int left;
+  int right;
+  int top;
+  int bottom;
+} WorkerSockets;
+
+static int write_all(int fd, const void *data, size_t size) {
+  const char *bytes = data;
+  while (size > 0) {
+    ssize_t written = send(fd, bytes, size, MSG_NOSIGNAL);
+    if (written < 0 && errno == EINTR)
+      continue;
+    if (written <= 0)
+      return -1;
+    bytes += written;
+    size -= written;
+  }
+  return 0;
+}
+
+static int read_all(int fd, void *data, size_t size) {
+  char *bytes = data;
+  while (size > 0) {
+    ssize_t received = read(fd, bytes, size);
+    if (received < 0 && errno == EINTR)
+      continue;
+    if (received <= 0)
+      return -1;
+    bytes += received;
+    size -= received;
+  }
+  return 0;
+}
+
+// Envoie et reçoit size octets en même temps sur la même socket : les deux
+// voisins peuvent échanger leurs bords sans risque d'interblocage, même si
+// les bords dépassent la taille des tampons du système
+static int exchange(int fd, const unsigned char *out, unsigned char *in,
+                    size_t size) {
+  size_t sent = 0;
+  size_t received = 0;
+  while (sent < size || received < size) {
+    struct pollfd descriptor = {fd, 0, 0};
+    if (sent < size)
+      descriptor.events |= POLLOUT;
+    if (received < size)
+      descriptor.events |= POLLIN;
+    if (poll(&descriptor, 1, -1) < 0) {
+      if (errno == EINTR)
+        continue;
+      return -1;
+    }
+    if (descriptor.revents & POLLOUT) {
+      ssize_t n =
+          send(fd, out + sent, size - sent, MSG_NOSIGNAL | MSG_DONTWAIT);
+      if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        return -1;
+      if (n > 0)
+        sent += n;
+    }
+    if (descriptor.revents & (POLLIN | POLLHUP | POLLERR)) {
+      ssize_t n = recv(fd, in + received, size - received, MSG_DONTWAIT);
+      if (n == 0)
+        return -1; // Voisin disparu
+      if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        return -1;
+      if (n > 0)
+        received += n;
+    }
+  }
+  return 0;
+}
+
+// Remplit la bordure de la tuile avec les bords des voisins. Les colonnes
+// sont échangées d'abord, puis les lignes sur toute la largeur (colonnes de
+// bordure comprises) : les coins arrivent ainsi des voisins diagonaux.
+static int exchange_halo(Board *tile, WorkerSockets *sockets,
+                         unsigned char *out, unsigned char *in) {
+  int height = tile->rows - 2;
+  int width = tile->cols - 2;
+
+  int column_neighbors[2] = {sockets->left, sockets->right};
+  for (int side = 0; side < 2; side++) {
+    int send_col = (side == 0) ? 1 : width;
+    int halo_col = (side == 0) ? 0 : width + 1;
+    if (column_neighbors[side] < 0) {
+      for (int i = 1; i <= height; i++) {
+        tile->cells[i][halo_col].state = DEAD;
+      }
+      continue;
+    }
+    for (int i = 1; i <= height; i++) {
+      out[i - 1] = tile->cells[i][send_col].state == ALIVE;
+    }
+    if (exchange(column_neighbors[side], out, in, height) < 0)
+      return -1;
+    for (int i = 1; i <= height; i++) {
+      tile->cells[i][halo_col].state = in[i - 1] ? ALIVE : DEAD;
+    }
+  }
+
+  int row_neighbors[2] = {sockets->top, sockets->bottom};
+  for (int side = 0; side < 2; side++) {
+    int send_row = (side == 0) ? 1 : height;
+    int halo_row = (side == 0) ? 0 : height + 1;
+    if (row_neighbors[side] < 0) {
+      for (int j = 0; j < width + 2; j++) {
+        tile->cells[halo_row][j].state = DEAD;
+      }
+      continue;
+    }
+    for (int j = 0; j < width + 2; j++) {
+      out[j] = tile->cells[send_row][j].state == ALIVE;
+    }
+    if (exchange(row_neighbors[side], out, in, width + 2) < 0)
+      return -1;
+    for (int j = 0; j < width + 2; j++) {
+      tile->cells[halo_row][j].state = in[j] ? ALIVE : DEAD;
+    }
+  }
+  return 0;
+}
+
+// Boucle d'un worker : la tuile est un Board avec une bordure d'une cellule,
+// calculé par advance_board (donc avec le moteur actif du coordinateur)
+static void run_worker(int height, int width, WorkerSockets *sockets) {
+  // Ctrl-C est géré par le coordinateur, qui arrête les workers proprement
+  signal(SIGINT, SIG_IGN);
+
+  Board *tile = create_board(height + 2, width + 2);
+  size_t tile_size = (size_t)height * width;
+  size_t halo_size = (height > width ? height : width) + 2;
+  unsigned char *buffer = malloc(tile_size > halo_size ? tile_size : halo_size);
+  unsigned char *halo = malloc(halo_size);
+  if (!tile || !buffer || !halo)
+    _exit(EXIT_FAILURE);
+
+  ClusterMessage message;
+  while (read_all(sockets->coordinator, &message, sizeof(message)) == 0) {
+    if (message.command == CMD_LOAD) {
+      if (read_all(sockets->coordinator, buffer, tile_size) < 0)
+        break;
+      for (int i = 0; i < height; i++) {
+        for (int j = 0; j < width; j++) {
+          tile->cells[i + 1][j + 1].state =
+              buffer[i * width + j] ? ALIVE : DEAD;
+        }
+      }
+    } else if (message.command == CMD_STEP) {
+      for (int n = 0; n < message.value; n++) {
+        if (exchange_halo(tile, sockets, buffer, halo) < 0 ||
+            !advance_board(tile, 1))
+          _exit(EXIT_FAILURE);
+      }
+    } else if (message.command == CMD_GATHER) {
+      for (int i = 0; i < height; i++) {
+        for (int j = 0; j < width; j++) {
+          buffer[i * width + j] = tile->cells[i + 1][j + 1].state == ALIVE;
+        }
+      }
+      if (write_all(sockets->coordinator, buffer, tile_size) < 0)
+        break;
+    } else {
+      break; // CMD_QUIT
+    }
+  }
+  _exit(EXIT_SUCCESS);
+}
+
+static int tile_index(Cluster *cluster, int tile_row, int tile_col) {
+  return tile_row * cluster->tile_cols + tile_col;
+}
+
+// Envoie à chaque worker sa tuile du plateau
+static int scatter(Cluster *cluster, Board *board) {
+  for (int tr = 0; tr < cluster->tile_rows; tr++) {
+    for (int tc = 0; tc < cluster->tile_cols; tc++) {
+      int row = cluster->row_starts[tr];
+      int col = cluster->col_starts[tc];
+      int height = cluster->row_starts[tr + 1] - row;
+      int width = cluster->col_starts[tc + 1] - col;
+      for (int i = 0; i < height; i++) {
+        for (int j = 0; j < width; j++) {
+          cluster->buffer[i * width + j] =
+              board->cells[row + i][col + j].state == ALIVE;
+        }
+      }
+      int fd = cluster->sockets[tile_index(cluster, tr, tc)];
+      ClusterMessage message = {CMD_LOAD, 0};
+      if (write_all(fd, &message, sizeof(message)) < 0 ||
+          write_all(fd, cluster->buffer, (size_t)height * width) < 0)
+        return -1;
+    }
+  }
+  cluster->generation = board->generation;
+  return 0;
+}
+
+// Rassemble les tuiles des workers dans la grille cells
+static int gather(Cluster *cluster, Cell **cells) {
+  ClusterMessage message = {CMD_GATHER, 0};
+  int count = cluster->tile_rows * cluster->tile_cols;
+  for (int n = 0; n < count; n++) {
+    if (write_all(cluster->sockets[n], &message, sizeof(message)) < 0)
+      return -1;
+  }
+
+  for (int tr = 0; tr < cluster->tile_rows; tr++) {
+    for (int tc = 0; tc < cluster->tile_cols; tc++) {
+      int row = cluster->row_starts[tr];
+      int col = cluster->col_starts[tc];
+      int height = cluster->row_starts[tr + 1] - row;
+      int width = cluster->col_starts[tc + 1] - col;
+      int fd = cluster->sockets[tile_index(cluster, tr, tc)];
+      if (read_all(fd, cluster->buffer, (size_t)height * width) < 0)
+        return -1;
+      for (int i = 0; i < height; i++) {
+        for (int j = 0; j < width; j++) {
+          cells[row + i][col + j].state =
+              cluster->buffer[i * width + j] ? ALIVE : DEAD;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+static void free_cluster(Cluster *cluster) {
+  free(cluster->row_starts);
+  free(cluster->col_starts);
+  free(cluster->pids);
+  free(cluster->sockets);
+  free(cluster->buffer);
+  free(cluster);
+}
+
+// Lance un worker par tuile et lui envoie l'état initial du plateau
+Cluster *start_cluster(Board *board, int tile_rows, int tile_cols) {
+  if (tile_rows < 1 || tile_cols < 1 || tile_rows > board->rows ||
+      tile_cols > board->cols) {
+    printf("Error: invalid tile layout %dx%d\n", tile_rows, tile_cols);
+    return NULL;
+  }
+
+  Cluster *cluster = malloc(sizeof(Cluster));
+  if (!cluster)
+    return NULL;
+  int count = tile_rows * tile_cols;
+  cluster->rows = board->rows;
+  cluster->cols = board->cols;
+  cluster->tile_rows = tile_rows;
+  cluster->tile_cols = tile_cols;
+  cluster->row_starts = malloc((tile_rows + 1) * sizeof(int));
+  cluster->col_starts = malloc((tile_cols + 1) * sizeof(int));
+  cluster->pids = malloc(count * sizeof(pid_t));
+  cluster->sockets = malloc(count * sizeof(int));
+  cluster->buffer = malloc(((size_t)board->rows / tile_rows + 1) *
+                           (board->cols / tile_cols + 1));
+
+  // Sockets : une paire coordinateur/worker par tuile, une paire par voisin
+  // horizontal et une par voisin vertical. Indices [0] côté coordinateur ou
+  // tuile de gauche/du haut, [1] côté worker ou tuile de droite/du bas.
+  int (*control)[2] = malloc(count * sizeof(int[2]));
+  int (*horizontal)[2] = malloc(count * sizeof(int[2]));
+  int (*vertical)[2] = malloc(count * sizeof(int[2]));
+  if (!cluster->row_starts || !cluster->col_starts || !cluster->pids ||
+      !cluster->sockets || !cluster->buffer || !control || !horizontal ||
+      !vertical) {
+    free(control);
+    free(horizontal);
+    free(vertical);
+    free_cluster(cluster);
+    return NULL;
+  }
+
+  for (int k = 0; k <= tile_rows; k++) {
+    cluster->row_starts[k] = (int)((long)k * board->rows / tile_rows);
+  }
+  for (int k = 0; k <= tile_cols; k++) {
+    cluster->col_starts[k] = (int)((long)k * board->cols / tile_cols);
+  }
+
+  int failed = 0;
+  for (int n = 0; n < count; n++) {
+    control[n][0] = control[n][1] = -1;
+    horizontal[n][0] = horizontal[n][1] = -1;
+    vertical[n][0] = vertical[n][1] = -1;
+  }
+  for (int tr = 0; tr < tile_rows; tr++) {
+    for (int tc = 0; tc < tile_cols; tc++) {
+      int n = tile_index(cluster, tr, tc);
+      // horizontal[n] relie la tuile n à sa voisine de droite, vertical[n] à
+      // sa voisine du bas
+      failed |= socketpair(AF_UNIX, SOCK_STREAM, 0, control[n]) < 0;
+      if (tc + 1 < tile_cols)
+        failed |= socketpair(AF_UNIX, SOCK_STREAM, 0, horizontal[n]) < 0;
+      if (tr + 1 < tile_rows)
+        failed |= socketpair(AF_UNIX, SOCK_STREAM, 0, vertical[n]) < 0;
+    }
+  }
+
+  // Les tampons de stdout seraient dupliqués dans chaque worker
+  fflush(stdout);
+  fflush(stderr);
+
+  int started = 0;
+  for (int tr = 0; tr < tile_rows && !failed; tr++) {
+    for (int tc = 0; tc < tile_cols && !failed; tc++) {
+      int n = tile_index(cluster, tr, tc);
+      pid_t pid = fork();
+      if (pid < 0) {
+        failed = 1;
+        break;
+      }
+      if (pid == 0) {
+        WorkerSockets sockets = {
+            control[n][1], (tc > 0) ? horizontal[n - 1][1] : -1,
+            horizontal[n][0], (tr > 0) ? vertical[n - tile_cols][1] : -1,
+            vertical[n][0]};
+        // Le worker ne garde que ses propres sockets, pour que la fermeture
+        // d'une extrémité soit bien vue comme une fin de fichier
+        for (int m = 0; m < count; m++) {
+          for (int side = 0; side < 2; side++) {
+            int *fds[3] = {&control[m][side], &horizontal[m][side],
+                           &vertical[m][side]};
+            for (int k = 0; k < 3; k++) {
+              int fd = *fds[k];
+              if (fd >= 0 && fd != sockets.coordinator &&
+                  fd != sockets.left && fd != sockets.right &&
+                  fd != sockets.top && fd != sockets.bottom)
+                close(fd);
+            }
+          }
+        }
+        run_worker(cluster->row_starts[tr + 1] - cluster->row_starts[tr],
+                   cluster->col_starts[tc + 1] - cluster->col_starts[tc],
+                   &sockets);
+      }
+      cluster->pids[n] = pid;
+      cluster->sockets[n] = control[n][0];
+      started++;
+    }
+  }
+
+  // Le coordinateur ne garde que ses sockets de contrôle
+  for (int n = 0; n < count; n++) {
+    if (control[n][1] >= 0)
+      close(control[n][1]);
+    if (n >= started && control[n][0] >= 0)
+      close(control[n][0]);
+    for (int side = 0; side < 2; side++) {
+      if (horizontal[n][side] >= 0)
+        close(horizontal[n][side]);
+      if (vertical[n][side] >= 0)
+        close(vertical[n][side]);
+    }
+  }
+  free(control);
+  free(horizontal);
+  free(vertical);
+
+  if (failed) {
+    printf("Error: cannot start cluster workers\n");
+    // Les workers déjà lancés voient la fermeture de leur socket et
+    // s'arrêtent d'eux-mêmes
+    for (int n = 0; n < started; n++) {
+      close(cluster->sockets[n]);
+      waitpid(cluster->pids[n], NULL, 0);
+    }
+    free_cluster(cluster);
+    return NULL;
+  }
+
+  if (scatter(cluster, board) < 0) {
+    stop_cluster(cluster);
+    return NULL;
+  }
+  return cluster;
+}
+
+// Avance de generations étapes sur les workers puis rassemble le résultat
+// dans le plateau. Si le plateau a été modifié localement depuis la dernière
+// étape (undo, saut dans la ligne temporelle...), il est d'abord renvoyé aux
+// workers. Si keep_history est vrai, l'état précédent est conservé dans
+// l'historique undo comme avec generate_next_cells ; sinon l'historique n'est
+// pas touché et doit être vidé par l'appelant, comme avec advance_board.
+// Retourne -1 si un worker s'est arrêté (fin de fichier ou erreur sur sa
+// socket) ou si la mémoire manque, le plateau est alors laissé intact. Les
+// lectures sont bloquantes : un worker en vie mais bloqué n'est pas détecté.
+int cluster_step(Cluster *cluster, Board *board, int generations,
+                 int keep_history) {
+  if (board->rows != cluster->rows || board->cols != cluster->cols)
+    return -1;
+  if (board->generation != cluster->generation &&
+      scatter(cluster, board) < 0)
+    return -1;
+
+  ClusterMessage message = {CMD_STEP, generations};
+  int count = cluster->tile_rows * cluster->tile_cols;
+  for (int n = 0; n < count; n++) {
+    if (write_all(cluster->sockets[n], &message, sizeof(message)) < 0)
+      return -1;
+  }
+  cluster->generation += generations;
+
+  // Sans historique, comme advance_board : les tuiles sont rassemblées dans
+  // une grille du pool, échangée avec celle du plateau une fois complète
+  if (!keep_history) {
+    Cell **cells = pool_acquire_grid(board->pool);
+    if (cells == NULL)
+      return -1;
+    if (gather(cluster, cells) < 0) {
+      pool_release_grid(board->pool, cells);
+      return -1;
+    }
+    pool_release_grid(board->pool, board->cells);
+    board->cells = cells;
+    board->generation = cluster->generation;
+    return 0;
+  }
+
+  // Sinon elles sont rassemblées dans la grille d'un noeud d'historique, qui
+  // devient le précédent du plateau comme dans generate_next_cells
+  Board *prev = pool_acquire_node(board->pool);
+  if (prev == NULL)
+    return -1;
+  if (gather(cluster, prev->cells) < 0) {
+    pool_release_node(board->pool, prev);
+    return -1;
+  }
+
+  // La nouvelle génération remplace l'éventuel redo
+  while (board->next) {
+    Board *next = board->next;
+    board->next = next->next;
+    pool_release_node(board->pool, next);
+  }
+
+  Cell **cells = prev->cells;
+  prev->cells = board->cells;
+  board->cells = cells;
+  prev->generation = board->generation;
+  board->generation = cluster->generation;
+
+  prev->prev = board->prev;
+  if (board->prev)
+    board->prev->next = prev;
+  prev->next = board;
+  board->prev = prev;
+  return 0;
+}
+
+void stop_cluster(Cluster *cluster) {
+  ClusterMessage message = {CMD_QUIT, 0};
+  int count = cluster->tile_rows * cluster->tile_cols;
+  for (int n = 0; n < count; n++) {
+    write_all(cluster->sockets[n], &message, sizeof(message));
+    close(cluster->sockets[n]);
+  }
+  for (int n = 0; n < count; n++) {
+    waitpid(cluster->pids[n], NULL, 0);
+  }
+  free_cluster(cluster);
+}
+
+#endif
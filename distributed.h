@@ -0,0 +1,34 @@
+#ifndef DISTRIBUTED_H
+#define DISTRIBUTED_H
+
+#include "gameoflife.h"
+#include "pool.h"
+
+// Simulation répartie : le plateau est découpé en tile_rows x tile_cols
+// tuiles, chacune calculée par un processus worker. A chaque génération, les
+// workers échangent directement leurs bords (une ligne ou une colonne de
+// cellules) avec leurs 4 voisins par sockets Unix : d'abord les colonnes,
+// puis les lignes complétées par les colonnes reçues, ce qui transmet aussi
+// les coins. Le résultat est identique à celui du calcul local.
+// Le coordinateur (le processus principal) répartit le plateau, commande les
+// étapes et rassemble les tuiles dans le Board pour l'affichage et
+// export_board. Non disponible sous Windows.
+typedef struct {
+  int rows;
+  int cols;
+  int tile_rows;
+  int tile_cols;
+  int *row_starts; // tile_rows + 1 bornes de découpage
+  int *col_starts; // tile_cols + 1 bornes de découpage
+  pid_t *pids;     // Un worker par tuile, ligne par ligne
+  int *sockets;    // Socket du coordinateur vers chaque worker
+  int generation;  // Génération détenue par les workers
+  unsigned char *buffer; // Tampon d'envoi et de réception d'une tuile
+} Cluster;
+
+Cluster *start_cluster(Board *board, int tile_rows, int tile_cols);
+int cluster_step(Cluster *cluster, Board *board, int generations,
+                 int keep_history);
+void stop_cluster(Cluster *cluster);
+
+#endif
@@ -1,15 +1,25 @@
 #include "gameoflife.h"
+#include "pool.h"
 
 Board *create_board(int rows, int cols) {
   Board *board = malloc(sizeof(Board));
+  if (!board)
+    return NULL;
+  board->pool = create_pool(rows, cols);
+  if (!board->pool) {
+    free(board);
+    return NULL;
+  }
   board->rows = rows;
   board->cols = cols;
-  board->cells = malloc(rows * sizeof(Cell *));
+  board->cells = pool_acquire_grid(board->pool);
   board->generation = 0;
   board->prev = NULL;
   board->next = NULL;
-  for (int i = 0; i < rows; i++) {
-    board->cells[i] = malloc(cols * sizeof(Cell));
+  if (!board->cells) {
+    destroy_pool(board->pool);
+    free(board);
+    return NULL;
   }
   // On initialise toutes les cellules à mortes pour commencer
   for (int i = 0; i < rows; i++) {
@@ -20,57 +30,41 @@ Board *create_board(int rows, int cols) {
   return board;
 }
 
+// Les grilles du pool ont une taille fixe : on bascule sur un nouveau pool et
+// l'historique, dont les dimensions ne correspondent plus, est abandonné
 void resize_board(Board *board, int rows, int cols) {
-  board->cells = realloc(board->cells, rows * sizeof(Cell *));
-  for (int i = 0; i < rows; i++) {
-    board->cells[i] = realloc(board->cells[i], cols * sizeof(Cell));
-  }
-  if (rows > board->rows) {
-    for (int i = board->rows; i < rows; i++) {
-      for (int j = 0; j < cols; j++) {
-        board->cells[i][j].state = DEAD;
-      }
-    }
+  BoardPool *pool = create_pool(rows, cols);
+  if (!pool)
+    return;
+  Cell **cells = pool_acquire_grid(pool);
+  if (!cells) {
+    destroy_pool(pool);
+    return;
   }
-  if (cols > board->cols) {
-    for (int i = 0; i < rows; i++) {
-      for (int j = board->cols; j < cols; j++) {
-        board->cells[i][j].state = DEAD;
+
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      if (i < board->rows && j < board->cols) {
+        cells[i][j] = board->cells[i][j];
+      } else {
+        cells[i][j].state = DEAD;
       }
     }
   }
+
+  destroy_pool(board->pool);
+  board->pool = pool;
+  board->cells = cells;
+  board->prev = NULL;
+  board->next = NULL;
   board->rows = rows;
   board->cols = cols;
 }
 
+// Toutes les grilles et tous les noeuds d'historique viennent du pool du
+// plateau : le libérer suffit, sans parcourir les générations
 void destroy_board(Board *board) {
-  // Pour chaque génération précédente, libérer la mémoire
-  while (board->prev) {
-    Board *prev = board->prev;
-    for (int i = 0; i < prev->rows; i++) {
-      free(prev->cells[i]);
-    }
-    free(prev->cells);
-    free(prev);
-    board->prev = NULL;
-  }
-
-  // Pour chaque génération suivante, libérer la mémoire
-  while (board->next) {
-    Board *next = board->next;
-    for (int i = 0; i < next->rows; i++) {
-      free(next->cells[i]);
-    }
-    free(next->cells);
-    free(next);
-    board->next = NULL;
-  }
-
-  // Free current board
-  for (int i = 0; i < board->rows; i++) {
-    free(board->cells[i]);
-  }
-  free(board->cells);
+  destroy_pool(board->pool);
   free(board);
 }
 
@@ -134,59 +128,58 @@ int print_board(Board *board) {
   return alive_cells;
 }
 
-void generate_next_cells(Board *board) {
-  // Si on génère depuis un état qui a déjà un "next", on doit d'abord effacer
-  // cet historique
-  if (board->next) {
-    Board *current_next = board->next;
-    while (current_next) {
-      Board *to_delete = current_next;
-      current_next = current_next->next;
-      for (int i = 0; i < to_delete->rows; i++) {
-        free(to_delete->cells[i]);
-      }
-      free(to_delete->cells);
-      free(to_delete);
-    }
-    board->next = NULL;
-  }
+// Moteur de calcul utilisé par generate_next_cells et advance_board
+static Engine active_engine = ENGINE_SCALAR;
 
-  // Sauvegarder l'état actuel
-  Board *prev = malloc(sizeof(Board));
-  prev->rows = board->rows;
-  prev->cols = board->cols;
-  prev->generation = board->generation;
-  prev->cells = malloc(board->rows * sizeof(Cell *));
+// Table du moteur ENGINE_LUT : pour chaque bloc 4x4 encodé sur 16 bits (bit
+// r * 4 + c pour la cellule ligne r, colonne c), les 4 bits du bloc 2x2
+// central à la génération suivante (bit 0 : (1,1), 1 : (1,2), 2 : (2,1),
+// 3 : (2,2))
+static unsigned char block_table[1 << 16];
 
-  for (int i = 0; i < board->rows; i++) {
-    prev->cells[i] = malloc(board->cols * sizeof(Cell));
-    memcpy(prev->cells[i], board->cells[i], board->cols * sizeof(Cell));
-  }
+// Grille 0/1 bordée de cellules mortes, réutilisée d'une étape à l'autre
+static unsigned char *padded_cells = NULL;
+static size_t padded_size = 0;
 
-  prev->prev = board->prev;
-  if (board->prev) {
-    board->prev->next = prev; // L'ancien prev pointe vers le nouveau prev
+// Appliquer les règles, partagées par tous les moteurs (plateau fixe, table,
+// plan infini)
+State apply_rule(State state, int alive_neighbors) {
+  if (state == ALIVE) {
+    return (alive_neighbors == 2 || alive_neighbors == 3) ? ALIVE : DEAD;
   }
-  board->prev = prev;
-
-  // Allouer la nouvelle grille
-  Cell **next_cells = malloc(board->rows * sizeof(Cell *));
-  if (next_cells == NULL)
-    return;
+  return (alive_neighbors == 3) ? ALIVE : DEAD;
+}
 
-  for (int i = 0; i < board->rows; i++) {
-    next_cells[i] = malloc(board->cols * sizeof(Cell));
-    if (next_cells[i] == NULL) {
-      // Nettoyer les allocations précédentes en cas d'échec
-      for (int j = 0; j < i; j++) {
-        free(next_cells[j]);
+// Construit block_table à partir de apply_rule
+static void build_block_table(void) {
+  for (int index = 0; index < (1 << 16); index++) {
+    unsigned char result = 0;
+    for (int k = 0; k < 4; k++) {
+      int r = 1 + k / 2;
+      int c = 1 + k % 2;
+      int alive_neighbors = 0;
+      for (int dr = -1; dr <= 1; dr++) {
+        for (int dc = -1; dc <= 1; dc++) {
+          if (dr != 0 || dc != 0)
+            alive_neighbors += (index >> ((r + dr) * 4 + c + dc)) & 1;
+        }
       }
-      free(next_cells);
-      return;
+      State state = ((index >> (r * 4 + c)) & 1) ? ALIVE : DEAD;
+      if (apply_rule(state, alive_neighbors) == ALIVE)
+        result |= 1 << k;
     }
+    block_table[index] = result;
   }
+}
 
-  // Calculer la prochaine génération
+void set_engine(Engine engine) {
+  if (engine == ENGINE_LUT && active_engine != ENGINE_LUT)
+    build_block_table();
+  active_engine = engine;
+}
+
+// Moteur de base : comptage des 8 voisins de chaque cellule
+static void compute_next_grid_scalar(Board *board, Cell **next_cells) {
   for (int i = 0; i < board->rows; i++) {
     for (int j = 0; j < board->cols; j++) {
       int alive_neighbors = 0;
@@ -203,22 +196,210 @@ void generate_next_cells(Board *board) {
         }
       }
 
-      // Appliquer les règles
-      if (board->cells[i][j].state == ALIVE) {
-        next_cells[i][j].state =
-            (alive_neighbors == 2 || alive_neighbors == 3) ? ALIVE : DEAD;
-      } else {
-        next_cells[i][j].state = (alive_neighbors == 3) ? ALIVE : DEAD;
-      }
+      next_cells[i][j].state =
+          apply_rule(board->cells[i][j].state, alive_neighbors);
     }
   }
+}
 
-  // Mettre à jour le board
+// Moteur à table : le plateau est parcouru par blocs 2x2, le voisinage 4x4 de
+// chaque bloc donne directement son état suivant dans block_table. Chaque
+// ligne du voisinage est une fenêtre de 4 bits qui glisse de 2 colonnes par
+// bloc, il suffit donc de lire 2 nouvelles cellules par ligne. Si la grille
+// bordée ne peut pas être agrandie, le calcul se fait avec le moteur de base.
+static void compute_next_grid_lut(Board *board, Cell **next_cells) {
+  // Bordure d'une cellule morte, plus une ligne et deux colonnes pour les
+  // dimensions impaires et la fin de la fenêtre glissante
+  int width = board->cols + 4;
+  size_t size = (size_t)(board->rows + 3) * width;
+  if (size > padded_size) {
+    unsigned char *grown = realloc(padded_cells, size);
+    if (!grown) {
+      compute_next_grid_scalar(board, next_cells);
+      return;
+    }
+    padded_cells = grown;
+    padded_size = size;
+  }
+  memset(padded_cells, 0, size);
   for (int i = 0; i < board->rows; i++) {
-    memcpy(board->cells[i], next_cells[i], board->cols * sizeof(Cell));
-    free(next_cells[i]);
+    unsigned char *row = padded_cells + (size_t)(i + 1) * width + 1;
+    for (int j = 0; j < board->cols; j++) {
+      row[j] = board->cells[i][j].state == ALIVE;
+    }
   }
-  free(next_cells);
+
+  for (int i = 0; i < board->rows; i += 2) {
+    unsigned char *r0 = padded_cells + (size_t)i * width;
+    unsigned char *r1 = r0 + width;
+    unsigned char *r2 = r1 + width;
+    unsigned char *r3 = r2 + width;
+    unsigned int n0 = r0[0] | r0[1] << 1;
+    unsigned int n1 = r1[0] | r1[1] << 1;
+    unsigned int n2 = r2[0] | r2[1] << 1;
+    unsigned int n3 = r3[0] | r3[1] << 1;
+    int has_next_row = i + 1 < board->rows;
+
+    for (int j = 0; j < board->cols; j += 2) {
+      n0 |= (r0[j + 2] | r0[j + 3] << 1) << 2;
+      n1 |= (r1[j + 2] | r1[j + 3] << 1) << 2;
+      n2 |= (r2[j + 2] | r2[j + 3] << 1) << 2;
+      n3 |= (r3[j + 2] | r3[j + 3] << 1) << 2;
+      unsigned char result = block_table[n0 | n1 << 4 | n2 << 8 | n3 << 12];
+
+      next_cells[i][j].state = (result & 1) ? ALIVE : DEAD;
+      if (has_next_row)
+        next_cells[i + 1][j].state = (result & 4) ? ALIVE : DEAD;
+      if (j + 1 < board->cols) {
+        next_cells[i][j + 1].state = (result & 2) ? ALIVE : DEAD;
+        if (has_next_row)
+          next_cells[i + 1][j + 1].state = (result & 8) ? ALIVE : DEAD;
+      }
+
+      n0 >>= 2;
+      n1 >>= 2;
+      n2 >>= 2;
+      n3 >>= 2;
+    }
+  }
+}
+
+// Calcule la génération suivante du plateau dans next_cells, sans toucher à
+// l'historique ni au compteur de générations
+static void compute_next_grid(Board *board, Cell **next_cells) {
+  if (active_engine == ENGINE_LUT) {
+    compute_next_grid_lut(board, next_cells);
+    return;
+  }
+  compute_next_grid_scalar(board, next_cells);
+}
+
+void generate_next_cells(Board *board) {
+  // Si on génère depuis un état qui a déjà un "next", on doit d'abord effacer
+  // cet historique
+  if (board->next) {
+    Board *current_next = board->next;
+    while (current_next) {
+      Board *to_delete = current_next;
+      current_next = current_next->next;
+      pool_release_node(board->pool, to_delete);
+    }
+    board->next = NULL;
+  }
+
+  // Le noeud recyclé du pool reçoit la nouvelle génération dans sa grille,
+  // puis les grilles sont échangées : le noeud garde l'état actuel sans copie
+  Board *prev = pool_acquire_node(board->pool);
+  if (prev == NULL)
+    return;
+  Cell **next_cells = prev->cells;
+
+  compute_next_grid(board, next_cells);
+
+  // Mettre à jour le board par échange de grilles
+  prev->cells = board->cells;
+  board->cells = next_cells;
+  prev->generation = board->generation;
+
+  prev->prev = board->prev;
+  if (board->prev) {
+    board->prev->next = prev; // L'ancien prev pointe vers le nouveau prev
+  }
+  prev->next = board;
+  board->prev = prev;
 
   board->generation++;
+}
+
+// Revient à la génération précédente en échangeant la grille du plateau avec
+// celle du noeud d'historique, qui devient le premier noeud du redo.
+// Retourne 0 s'il n'y a pas d'historique.
+int undo_generation(Board *board) {
+  Board *prev = board->prev;
+  if (!prev)
+    return 0;
+
+  Cell **cells = board->cells;
+  board->cells = prev->cells;
+  prev->cells = cells;
+  int generation = board->generation;
+  board->generation = prev->generation;
+  prev->generation = generation;
+
+  // Update des pointeurs : prev passe de l'historique undo au redo
+  board->prev = prev->prev;
+  if (board->prev) {
+    board->prev->next = board;
+  }
+  prev->next = board->next;
+  if (prev->next) {
+    prev->next->prev = prev;
+  }
+  prev->prev = board;
+  board->next = prev;
+  return 1;
+}
+
+// Symétrique de undo_generation. Retourne 0 s'il n'y a rien à refaire.
+int redo_generation(Board *board) {
+  Board *next = board->next;
+  if (!next)
+    return 0;
+
+  Cell **cells = board->cells;
+  board->cells = next->cells;
+  next->cells = cells;
+  int generation = board->generation;
+  board->generation = next->generation;
+  next->generation = generation;
+
+  // Update des pointeurs : next passe du redo à l'historique undo
+  board->next = next->next;
+  if (board->next) {
+    board->next->prev = board;
+  }
+  next->prev = board->prev;
+  if (next->prev) {
+    next->prev->next = next;
+  }
+  next->next = board;
+  board->prev = next;
+  return 1;
+}
+
+// Rend au pool tous les noeuds d'historique (undo et redo) du plateau
+void clear_history(Board *board) {
+  while (board->prev) {
+    Board *prev = board->prev;
+    board->prev = prev->prev;
+    pool_release_node(board->pool, prev);
+  }
+  while (board->next) {
+    Board *next = board->next;
+    board->next = next->next;
+    pool_release_node(board->pool, next);
+  }
+}
+
+// Avance de plusieurs générations sans enregistrer d'historique : deux
+// grilles seulement sont utilisées, échangées à chaque étape. L'historique
+// existant ne correspond plus au plateau et doit être vidé par l'appelant.
+// Retourne 0 si la grille de calcul n'a pas pu être allouée (le plateau n'a
+// alors pas avancé).
+int advance_board(Board *board, int generations) {
+  if (generations <= 0)
+    return 1;
+  Cell **next_cells = pool_acquire_grid(board->pool);
+  if (next_cells == NULL)
+    return 0;
+
+  for (int n = 0; n < generations; n++) {
+    compute_next_grid(board, next_cells);
+    Cell **cells = board->cells;
+    board->cells = next_cells;
+    next_cells = cells;
+    board->generation++;
+  }
+  pool_release_grid(board->pool, next_cells);
+  return 1;
 }
\ No newline at end of file
@@ -13,10 +13,17 @@
 
 typedef enum { ALIVE, DEAD } State;
 
+// Moteurs de calcul des générations : ENGINE_SCALAR compte les voisins de
+// chaque cellule, ENGINE_LUT traite des blocs 2x2 à l'aide d'une table
+// précalculée à partir de la règle
+typedef enum { ENGINE_SCALAR, ENGINE_LUT } Engine;
+
 typedef struct {
   State state;
 } Cell;
 
+struct BoardPool;
+
 typedef struct Board {
   int rows;
   int cols;
@@ -24,6 +31,7 @@ typedef struct Board {
   int generation;
   struct Board *prev; // Pointeur vers la génération précédente pour le undo
   struct Board *next; // Pointeur vers la génération suivante pour le redo
+  struct BoardPool *pool; // Pool partagé par le plateau et son historique
 } Board;
 
 Board *create_board(int rows, int cols);
@@ -32,6 +40,12 @@ void destroy_board(Board *board);
 void import_board(Board *board, char *filename);
 void export_board(Board *board, char *filename);
 int print_board(Board *board);
+State apply_rule(State state, int alive_neighbors);
+void set_engine(Engine engine);
 void generate_next_cells(Board *board);
+int undo_generation(Board *board);
+int redo_generation(Board *board);
+void clear_history(Board *board);
+int advance_board(Board *board, int generations);
 
 #endif
\ No newline at end of file
@@ -38,6 +38,11 @@ SDLContext *init_sdl(int rows, int cols, int speed) {
   context->offset_y = 0;
   context->paused = 0;
   context->zoom = 1.0f;
+  context->timeline = NULL;
+  context->infinite = NULL;
+  context->scrubbing = 0;
+  context->jump_active = 0;
+  context->jump_input[0] = '\0';
 
   int cell_width = WINDOW_WIDTH / cols;
   int cell_height = WINDOW_HEIGHT / rows;
@@ -121,7 +126,9 @@ void render_help(SDLContext *context) {
                             "R : Reset vue",
                             "Q : Génération précédente",
                             "D : Génération suivante",
-                            "S : Sauvegarder l'état"};
+                            "S : Sauvegarder l'état",
+                            "G : Aller à une génération",
+                            "Clic barre : Parcourir l'historique"};
 
   int x = WINDOW_WIDTH - 250; // Position X fixe pour la liste
   int y = 10;                 // Commence en haut
@@ -189,6 +196,72 @@ void render_save_message(SDLContext *context) {
   }
 }
 
+// Première et dernière générations couvertes par la barre de la ligne
+// temporelle
+static void timeline_range(SDLContext *context, Board *board, int *first,
+                           int *last) {
+  *first = context->timeline->keyframes[0].generation;
+  *last = context->timeline->max_generation;
+  if (board->generation > *last)
+    *last = board->generation;
+}
+
+// Génération correspondant à l'abscisse x sur la barre
+static int timeline_generation_at(SDLContext *context, Board *board, int x) {
+  int first, last;
+  timeline_range(context, board, &first, &last);
+  int width = WINDOW_WIDTH - 2 * TIMELINE_MARGIN;
+  if (x < TIMELINE_MARGIN)
+    x = TIMELINE_MARGIN;
+  if (x > TIMELINE_MARGIN + width)
+    x = TIMELINE_MARGIN + width;
+  return first + (int)((long long)(x - TIMELINE_MARGIN) * (last - first) /
+                       width);
+}
+
+// Barre de la ligne temporelle en bas de la fenêtre, avec la saisie du saut
+// à une génération si elle est en cours
+void render_timeline(SDLContext *context, Board *board) {
+  if (!context->timeline)
+    return;
+
+  int first, last;
+  timeline_range(context, board, &first, &last);
+  int width = WINDOW_WIDTH - 2 * TIMELINE_MARGIN;
+  int position = (last > first) ? (int)((long long)(board->generation - first) *
+                                        width / (last - first))
+                                : width;
+
+  SDL_Rect bar = {TIMELINE_MARGIN, TIMELINE_Y, width, TIMELINE_HEIGHT};
+  SDL_SetRenderDrawColor(context->renderer, 64, 64, 64, 255);
+  SDL_RenderFillRect(context->renderer, &bar);
+
+  SDL_Rect done = {TIMELINE_MARGIN, TIMELINE_Y, position, TIMELINE_HEIGHT};
+  SDL_SetRenderDrawColor(context->renderer, 0, 160, 0, 255);
+  SDL_RenderFillRect(context->renderer, &done);
+
+  SDL_Rect cursor = {TIMELINE_MARGIN + position - 2, TIMELINE_Y - 4, 4,
+                     TIMELINE_HEIGHT + 8};
+  SDL_SetRenderDrawColor(context->renderer, 255, 255, 255, 255);
+  SDL_RenderFillRect(context->renderer, &cursor);
+
+  char text[64];
+  if (context->jump_active) {
+    snprintf(text, sizeof(text), "Aller à la génération : %s_",
+             context->jump_input);
+  } else {
+    snprintf(text, sizeof(text), "%d / %d", board->generation, last);
+  }
+  SDL_Color text_color = {255, 255, 255, 255};
+  int w, h;
+  SDL_Texture *texture = render_text(context, text, text_color, &w, &h);
+  if (texture) {
+    SDL_Rect dest = {TIMELINE_MARGIN, TIMELINE_Y - h - 6, w, h};
+    SDL_RenderCopy(context->renderer, texture, NULL, &dest);
+    SDL_DestroyTexture(texture);
+  }
+}
+
 void render_board(SDLContext *context, Board *board) {
   if (!context || !board || !context->renderer)
     return;
@@ -241,6 +314,9 @@ void render_board(SDLContext *context, Board *board) {
   // Affichage des commandes
   render_help(context);
 
+  // Affichage de la ligne temporelle
+  render_timeline(context, board);
+
   // Affichage du message de sauvegarde
   render_save_message(context);
 
@@ -267,6 +343,30 @@ void handle_events(SDLContext *context, Board *board) {
       break;
 
     case SDL_KEYDOWN:
+      // Pendant la saisie d'une génération, les touches ne servent qu'à
+      // valider, annuler ou corriger
+      if (context->jump_active) {
+        switch (event.key.keysym.sym) {
+        case SDLK_RETURN:
+        case SDLK_KP_ENTER:
+          if (context->jump_input[0] != '\0') {
+            timeline_jump(context->timeline, board, atoi(context->jump_input));
+          }
+          context->jump_active = 0;
+          break;
+        case SDLK_ESCAPE:
+          context->jump_active = 0;
+          break;
+        case SDLK_BACKSPACE: {
+          size_t length = strlen(context->jump_input);
+          if (length > 0)
+            context->jump_input[length - 1] = '\0';
+          break;
+        }
+        }
+        break;
+      }
+
       switch (event.key.keysym.sym) {
       case SDLK_SPACE:
         context->paused = !context->paused;
@@ -277,33 +377,15 @@ void handle_events(SDLContext *context, Board *board) {
         context->offset_y = 0;
         break;
       case SDLK_d: // Prochaine génération
-        if (context->paused) {
-          if (board->next) {
-            // Si une génération suivante existe, on la restaure
-            Board *next = board->next;
-
-            // Copie de l'état suivant
-            for (int i = 0; i < board->rows; i++) {
-              memcpy(board->cells[i], next->cells[i],
-                     board->cols * sizeof(Cell));
-            }
-            board->generation = next->generation;
-
-            // Update des pointeurs
-            board->next = next->next;
-            if (board->next) {
-              board->next->prev = board;
-            }
-
-            // Libération de la mémoire
-            for (int i = 0; i < next->rows; i++) {
-              free(next->cells[i]);
-            }
-            free(next->cells);
-            free(next);
-          } else {
-            // Sinon on génère une nouvelle génération
+        if (context->paused && context->infinite) {
+          step_infinite_view(context->infinite, board);
+        } else if (context->paused) {
+          // Si une génération suivante existe, on la restaure par échange de
+          // grilles, sinon on génère une nouvelle génération
+          if (!redo_generation(board)) {
             generate_next_cells(board);
+            if (context->timeline)
+              timeline_record(context->timeline, board);
           }
         }
         break;
@@ -313,32 +395,55 @@ void handle_events(SDLContext *context, Board *board) {
         }
         break;
       case SDLK_q: // Précédente génération
-        if (context->paused && board->prev) {
-          Board *prev = board->prev;
+        if (context->paused) {
+          undo_generation(board);
+        }
+        break;
+      case SDLK_g: // Aller à une génération (saisie au clavier)
+        if (context->timeline) {
+          context->paused = 1;
+          context->jump_active = 1;
+          context->jump_input[0] = '\0';
+        }
+        break;
+      }
+      break;
 
-          // Copie de l'état précédent
-          for (int i = 0; i < board->rows; i++) {
-            memcpy(board->cells[i], prev->cells[i], board->cols * sizeof(Cell));
+    case SDL_TEXTINPUT: // Chiffres du numéro de génération
+      if (context->jump_active) {
+        size_t length = strlen(context->jump_input);
+        for (const char *c = event.text.text; *c; c++) {
+          if (*c >= '0' && *c <= '9' && length < JUMP_INPUT_LENGTH - 1) {
+            context->jump_input[length++] = *c;
           }
-          board->generation = prev->generation;
+        }
+        context->jump_input[length] = '\0';
+      }
+      break;
 
-          // Update des pointeurs
-          board->prev = prev->prev;
-          if (board->prev) {
-            board->prev->next = board;
-          }
+    case SDL_MOUSEBUTTONDOWN: // Clic sur la ligne temporelle
+      if (context->timeline && event.button.button == SDL_BUTTON_LEFT &&
+          event.button.y >= TIMELINE_Y - 4 &&
+          event.button.y <= TIMELINE_Y + TIMELINE_HEIGHT + 4) {
+        context->paused = 1;
+        context->scrubbing = 1;
+        timeline_jump(context->timeline, board,
+                      timeline_generation_at(context, board, event.button.x));
+      }
+      break;
 
-          // Libération de la mémoire
-          for (int i = 0; i < prev->rows; i++) {
-            free(prev->cells[i]);
-          }
-          free(prev->cells);
-          free(prev);
-        }
-        break;
+    case SDL_MOUSEMOTION: // Glissement sur la ligne temporelle
+      if (context->scrubbing) {
+        timeline_jump(context->timeline, board,
+                      timeline_generation_at(context, board, event.motion.x));
       }
       break;
 
+    case SDL_MOUSEBUTTONUP:
+      if (event.button.button == SDL_BUTTON_LEFT)
+        context->scrubbing = 0;
+      break;
+
     case SDL_MOUSEWHEEL: // Zoom
       if (event.wheel.y > 0) {
         context->zoom *= 1.1f;
@@ -2,6 +2,9 @@
 #define GAMEOFLIFE_SDL_H
 
 #include "gameoflife.h"
+#include "infinite_board.h"
+#include "pool.h"
+#include "timeline.h"
 #include "utilities.h"
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
@@ -16,6 +19,10 @@
 #define WINDOW_WIDTH 1920
 #define WINDOW_HEIGHT 1080
 #define PAN_SPEED 30
+#define TIMELINE_MARGIN 10
+#define TIMELINE_HEIGHT 12
+#define TIMELINE_Y (WINDOW_HEIGHT - 40)
+#define JUMP_INPUT_LENGTH 10
 
 // Structure pour le message de sauvegarde
 typedef struct {
@@ -37,6 +44,11 @@ typedef struct {
   float zoom;
   int simulation_speed;
   SaveMessage save_message;
+  Timeline *timeline; // Ligne temporelle pour la barre et le saut (optionnelle)
+  int scrubbing;      // Glissement en cours sur la barre de la ligne temporelle
+  int jump_active;    // Saisie en cours du numéro de génération (touche G)
+  char jump_input[JUMP_INPUT_LENGTH];
+  InfiniteBoard *infinite; // Plan infini affiché dans le plateau (optionnel)
 } SDLContext;
 
 SDLContext *init_sdl(int rows, int cols, int speed);
@@ -46,6 +58,7 @@ SDL_Texture *render_text(SDLContext *context, const char *text, SDL_Color color,
 void render_help(SDLContext *context);
 void set_save_message(SDLContext *context, const char *message);
 void render_save_message(SDLContext *context);
+void render_timeline(SDLContext *context, Board *board);
 void render_board(SDLContext *context, Board *board);
 void handle_events(SDLContext *context, Board *board);
 void save_current_state(SDLContext *context, Board *board);
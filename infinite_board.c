@@ -0,0 +1,380 @@
+#include "infinite_board.h"
+
+// Division entière arrondie vers -infini (les coordonnées peuvent être
+// négatives sur le plan infini)
+static int floor_div(int value, int divisor) {
+  int q = value / divisor;
+  if ((value % divisor != 0) && ((value < 0) != (divisor < 0)))
+    q--;
+  return q;
+}
+
+static int floor_mod(int value, int divisor) {
+  return value - floor_div(value, divisor) * divisor;
+}
+
+static unsigned int hash_chunk(int chunk_row, int chunk_col) {
+  unsigned int h = (unsigned int)chunk_row * 73856093u;
+  h ^= (unsigned int)chunk_col * 19349663u;
+  return h;
+}
+
+InfiniteBoard *create_infinite_board(void) {
+  InfiniteBoard *board = malloc(sizeof(InfiniteBoard));
+  if (!board)
+    return NULL;
+  board->bucket_count = INITIAL_BUCKETS;
+  board->buckets = calloc(board->bucket_count, sizeof(Chunk *));
+  board->chunk_capacity = INITIAL_BUCKETS;
+  board->chunks = malloc(board->chunk_capacity * sizeof(Chunk *));
+  board->chunk_count = 0;
+  board->free_chunks = NULL;
+  board->generation = 0;
+  board->population = 0;
+  board->view_row = 0;
+  board->view_col = 0;
+  if (!board->buckets || !board->chunks) {
+    free(board->buckets);
+    free(board->chunks);
+    free(board);
+    return NULL;
+  }
+  return board;
+}
+
+void destroy_infinite_board(InfiniteBoard *board) {
+  for (int i = 0; i < board->chunk_count; i++) {
+    free(board->chunks[i]);
+  }
+  while (board->free_chunks) {
+    Chunk *chunk = board->free_chunks;
+    board->free_chunks = chunk->hash_next;
+    free(chunk);
+  }
+  free(board->chunks);
+  free(board->buckets);
+  free(board);
+}
+
+static Chunk *find_chunk(InfiniteBoard *board, int chunk_row, int chunk_col) {
+  unsigned int bucket =
+      hash_chunk(chunk_row, chunk_col) & (board->bucket_count - 1);
+  for (Chunk *chunk = board->buckets[bucket]; chunk; chunk = chunk->hash_next) {
+    if (chunk->chunk_row == chunk_row && chunk->chunk_col == chunk_col)
+      return chunk;
+  }
+  return NULL;
+}
+
+// Double le nombre de buckets quand la table devient trop chargée
+static void grow_buckets(InfiniteBoard *board) {
+  int bucket_count = board->bucket_count * 2;
+  Chunk **buckets = calloc(bucket_count, sizeof(Chunk *));
+  if (!buckets)
+    return; // On garde l'ancienne table, plus lente mais valide
+
+  for (int i = 0; i < board->chunk_count; i++) {
+    Chunk *chunk = board->chunks[i];
+    unsigned int bucket =
+        hash_chunk(chunk->chunk_row, chunk->chunk_col) & (bucket_count - 1);
+    chunk->hash_next = buckets[bucket];
+    buckets[bucket] = chunk;
+  }
+  free(board->buckets);
+  board->buckets = buckets;
+  board->bucket_count = bucket_count;
+}
+
+// Récupère un chunk existant ou en prend un dans le pool (vide)
+static Chunk *get_or_create_chunk(InfiniteBoard *board, int chunk_row,
+                                  int chunk_col) {
+  Chunk *chunk = find_chunk(board, chunk_row, chunk_col);
+  if (chunk)
+    return chunk;
+
+  if (board->chunk_count == board->chunk_capacity) {
+    int capacity = board->chunk_capacity * 2;
+    Chunk **chunks = realloc(board->chunks, capacity * sizeof(Chunk *));
+    if (!chunks)
+      return NULL;
+    board->chunks = chunks;
+    board->chunk_capacity = capacity;
+  }
+
+  if (board->free_chunks) {
+    chunk = board->free_chunks;
+    board->free_chunks = chunk->hash_next;
+  } else {
+    chunk = malloc(sizeof(Chunk));
+    if (!chunk)
+      return NULL;
+  }
+
+  chunk->chunk_row = chunk_row;
+  chunk->chunk_col = chunk_col;
+  chunk->alive = 0;
+  chunk->current = 0;
+  for (int i = 0; i < CHUNK_SIZE; i++) {
+    for (int j = 0; j < CHUNK_SIZE; j++) {
+      chunk->buffers[0][i][j].state = DEAD;
+    }
+  }
+
+  chunk->index = board->chunk_count;
+  board->chunks[board->chunk_count++] = chunk;
+
+  if (board->chunk_count * 4 > board->bucket_count * 3) {
+    grow_buckets(board); // Réinsère aussi le nouveau chunk
+  } else {
+    unsigned int bucket =
+        hash_chunk(chunk_row, chunk_col) & (board->bucket_count - 1);
+    chunk->hash_next = board->buckets[bucket];
+    board->buckets[bucket] = chunk;
+  }
+  return chunk;
+}
+
+// Retire un chunk de la table et le rend au pool
+static void release_chunk(InfiniteBoard *board, Chunk *chunk) {
+  unsigned int bucket =
+      hash_chunk(chunk->chunk_row, chunk->chunk_col) & (board->bucket_count - 1);
+  Chunk **link = &board->buckets[bucket];
+  while (*link != chunk) {
+    link = &(*link)->hash_next;
+  }
+  *link = chunk->hash_next;
+
+  // Suppression par échange avec le dernier élément du tableau dense
+  Chunk *last = board->chunks[--board->chunk_count];
+  board->chunks[chunk->index] = last;
+  last->index = chunk->index;
+
+  chunk->hash_next = board->free_chunks;
+  board->free_chunks = chunk;
+}
+
+State get_infinite_cell(InfiniteBoard *board, int row, int col) {
+  Chunk *chunk =
+      find_chunk(board, floor_div(row, CHUNK_SIZE), floor_div(col, CHUNK_SIZE));
+  if (!chunk)
+    return DEAD;
+  return chunk->buffers[chunk->current][floor_mod(row, CHUNK_SIZE)]
+                       [floor_mod(col, CHUNK_SIZE)]
+                           .state;
+}
+
+void set_infinite_cell(InfiniteBoard *board, int row, int col, State state) {
+  int chunk_row = floor_div(row, CHUNK_SIZE);
+  int chunk_col = floor_div(col, CHUNK_SIZE);
+  Chunk *chunk = (state == ALIVE)
+                     ? get_or_create_chunk(board, chunk_row, chunk_col)
+                     : find_chunk(board, chunk_row, chunk_col);
+  if (!chunk)
+    return;
+
+  Cell *cell = &chunk->buffers[chunk->current][floor_mod(row, CHUNK_SIZE)]
+                              [floor_mod(col, CHUNK_SIZE)];
+  if (cell->state == state)
+    return;
+
+  cell->state = state;
+  if (state == ALIVE) {
+    chunk->alive++;
+    board->population++;
+  } else {
+    chunk->alive--;
+    board->population--;
+    if (chunk->alive == 0)
+      release_chunk(board, chunk);
+  }
+}
+
+// Importe un motif au même format que import_board ('O' vivant, '.' mort)
+// avec son coin supérieur gauche en (row, col). Les lignes peuvent avoir des
+// longueurs quelconques puisque le plan n'a pas de bord.
+void import_infinite_board(InfiniteBoard *board, char *filename, int row,
+                           int col) {
+  FILE *file = fopen(filename, "r");
+  if (file == NULL) {
+    printf("Error: File not found\n");
+    return;
+  }
+  int i = 0;
+  int j = 0;
+  int c;
+  while ((c = fgetc(file)) != EOF) {
+    if (c == '\n') {
+      i++;
+      j = 0;
+    } else if (c == 'O') {
+      set_infinite_cell(board, row + i, col + j++, ALIVE);
+    } else if (c == '.') {
+      j++;
+    }
+  }
+  fclose(file);
+}
+
+// Copie la fenêtre du plan commençant en (row, col) dans un Board classique,
+// ce qui permet de réutiliser export_board et les fonctions d'affichage
+void copy_infinite_region(InfiniteBoard *board, Board *view, int row, int col) {
+  for (int i = 0; i < view->rows; i++) {
+    for (int j = 0; j < view->cols; j++) {
+      view->cells[i][j].state = get_infinite_cell(board, row + i, col + j);
+    }
+  }
+  view->generation = board->generation;
+}
+
+// Calcule le rectangle englobant des cellules vivantes, retourne 0 si le plan
+// est vide
+int infinite_board_bounds(InfiniteBoard *board, int *min_row, int *min_col,
+                          int *max_row, int *max_col) {
+  int found = 0;
+  for (int n = 0; n < board->chunk_count; n++) {
+    Chunk *chunk = board->chunks[n];
+    Cell(*cells)[CHUNK_SIZE] = chunk->buffers[chunk->current];
+    for (int i = 0; i < CHUNK_SIZE; i++) {
+      for (int j = 0; j < CHUNK_SIZE; j++) {
+        if (cells[i][j].state != ALIVE)
+          continue;
+        int r = chunk->chunk_row * CHUNK_SIZE + i;
+        int c = chunk->chunk_col * CHUNK_SIZE + j;
+        if (!found || r < *min_row)
+          *min_row = r;
+        if (!found || r > *max_row)
+          *max_row = r;
+        if (!found || c < *min_col)
+          *min_col = c;
+        if (!found || c > *max_col)
+          *max_col = c;
+        found = 1;
+      }
+    }
+  }
+  return found;
+}
+
+// Crée les chunks voisins vers lesquels des cellules vivantes du bord peuvent
+// faire naître de nouvelles cellules à la prochaine génération
+static void ensure_neighbor_chunks(InfiniteBoard *board, Chunk *chunk) {
+  Cell(*cells)[CHUNK_SIZE] = chunk->buffers[chunk->current];
+  int top = 0, bottom = 0, left = 0, right = 0;
+  for (int k = 0; k < CHUNK_SIZE; k++) {
+    top |= cells[0][k].state == ALIVE;
+    bottom |= cells[CHUNK_SIZE - 1][k].state == ALIVE;
+    left |= cells[k][0].state == ALIVE;
+    right |= cells[k][CHUNK_SIZE - 1].state == ALIVE;
+  }
+  int row = chunk->chunk_row;
+  int col = chunk->chunk_col;
+
+  if (top)
+    get_or_create_chunk(board, row - 1, col);
+  if (bottom)
+    get_or_create_chunk(board, row + 1, col);
+  if (left)
+    get_or_create_chunk(board, row, col - 1);
+  if (right)
+    get_or_create_chunk(board, row, col + 1);
+  if (cells[0][0].state == ALIVE)
+    get_or_create_chunk(board, row - 1, col - 1);
+  if (cells[0][CHUNK_SIZE - 1].state == ALIVE)
+    get_or_create_chunk(board, row - 1, col + 1);
+  if (cells[CHUNK_SIZE - 1][0].state == ALIVE)
+    get_or_create_chunk(board, row + 1, col - 1);
+  if (cells[CHUNK_SIZE - 1][CHUNK_SIZE - 1].state == ALIVE)
+    get_or_create_chunk(board, row + 1, col + 1);
+}
+
+// Calcule la génération suivante d'un chunk dans son buffer inactif. Les
+// cellules du chunk et la bordure issue des 8 voisins sont d'abord copiées
+// dans une grille locale (CHUNK_SIZE + 2)² pour ne faire que 9 recherches.
+static void compute_chunk(InfiniteBoard *board, Chunk *chunk) {
+  unsigned char local[CHUNK_SIZE + 2][CHUNK_SIZE + 2];
+  memset(local, 0, sizeof(local));
+
+  for (int dr = -1; dr <= 1; dr++) {
+    for (int dc = -1; dc <= 1; dc++) {
+      Chunk *neighbor =
+          (dr == 0 && dc == 0)
+              ? chunk
+              : find_chunk(board, chunk->chunk_row + dr, chunk->chunk_col + dc);
+      if (!neighbor || neighbor->alive == 0)
+        continue;
+
+      Cell(*cells)[CHUNK_SIZE] = neighbor->buffers[neighbor->current];
+      // Plage des lignes/colonnes du voisin qui tombent dans la grille locale
+      int row_start = (dr < 0) ? CHUNK_SIZE - 1 : 0;
+      int row_end = (dr > 0) ? 1 : CHUNK_SIZE;
+      int col_start = (dc < 0) ? CHUNK_SIZE - 1 : 0;
+      int col_end = (dc > 0) ? 1 : CHUNK_SIZE;
+      for (int i = row_start; i < row_end; i++) {
+        for (int j = col_start; j < col_end; j++) {
+          local[i + 1 + dr * CHUNK_SIZE][j + 1 + dc * CHUNK_SIZE] =
+              cells[i][j].state == ALIVE;
+        }
+      }
+    }
+  }
+
+  Cell(*next_cells)[CHUNK_SIZE] = chunk->buffers[!chunk->current];
+  int alive = 0;
+  for (int i = 1; i <= CHUNK_SIZE; i++) {
+    for (int j = 1; j <= CHUNK_SIZE; j++) {
+      int alive_neighbors = local[i - 1][j - 1] + local[i - 1][j] +
+                            local[i - 1][j + 1] + local[i][j - 1] +
+                            local[i][j + 1] + local[i + 1][j - 1] +
+                            local[i + 1][j] + local[i + 1][j + 1];
+
+      State state = apply_rule(local[i][j] ? ALIVE : DEAD, alive_neighbors);
+      next_cells[i - 1][j - 1].state = state;
+      alive += state == ALIVE;
+    }
+  }
+  // Le compteur courant n'est mis à jour qu'après l'échange des buffers pour
+  // que les voisins calculés ensuite lisent encore la génération courante
+  chunk->next_alive = alive;
+}
+
+void generate_next_infinite_cells(InfiniteBoard *board) {
+  // Les chunks créés ici sont vides : inutile de les parcourir à leur tour
+  int count = board->chunk_count;
+  for (int n = 0; n < count; n++) {
+    ensure_neighbor_chunks(board, board->chunks[n]);
+  }
+
+  for (int n = 0; n < board->chunk_count; n++) {
+    compute_chunk(board, board->chunks[n]);
+  }
+
+  // Échanger les buffers et rendre au pool les chunks devenus vides
+  board->population = 0;
+  for (int n = board->chunk_count - 1; n >= 0; n--) {
+    Chunk *chunk = board->chunks[n];
+    chunk->current = !chunk->current;
+    chunk->alive = chunk->next_alive;
+    board->population += chunk->alive;
+    if (chunk->alive == 0)
+      release_chunk(board, chunk);
+  }
+
+  board->generation++;
+}
+
+// Avance d'une génération et met à jour la fenêtre view. Quand des cellules
+// vivantes sortent de la fenêtre, elle est recentrée sur leur rectangle
+// englobant pour suivre les vaisseaux et les canons.
+void step_infinite_view(InfiniteBoard *board, Board *view) {
+  generate_next_infinite_cells(board);
+
+  int min_row, min_col, max_row, max_col;
+  if (infinite_board_bounds(board, &min_row, &min_col, &max_row, &max_col) &&
+      (min_row < board->view_row || min_col < board->view_col ||
+       max_row >= board->view_row + view->rows ||
+       max_col >= board->view_col + view->cols)) {
+    board->view_row = (min_row + max_row) / 2 - view->rows / 2;
+    board->view_col = (min_col + max_col) / 2 - view->cols / 2;
+  }
+  copy_infinite_region(board, view, board->view_row, board->view_col);
+}
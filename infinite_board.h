@@ -0,0 +1,51 @@
+#ifndef INFINITE_BOARD_H
+#define INFINITE_BOARD_H
+
+#include "gameoflife.h"
+
+// Taille (en cellules) du côté d'un chunk, doit rester une puissance de 2
+#define CHUNK_SIZE 32
+#define INITIAL_BUCKETS 64
+
+// Un chunk est un carré de CHUNK_SIZE x CHUNK_SIZE cellules. Il possède deux
+// buffers : la génération courante et la suivante, échangés à chaque étape.
+typedef struct Chunk {
+  int chunk_row; // Coordonnées du chunk (en chunks, pas en cellules)
+  int chunk_col;
+  int alive;      // Nombre de cellules vivantes dans la génération courante
+  int next_alive; // Nombre de cellules vivantes dans le buffer suivant
+  int current;    // Index du buffer courant dans buffers
+  int index;      // Position dans le tableau dense des chunks actifs
+  Cell buffers[2][CHUNK_SIZE][CHUNK_SIZE];
+  struct Chunk *hash_next; // Chaînage du bucket (ou de la liste libre du pool)
+} Chunk;
+
+// Plan infini : table de hachage des chunks actifs. Seuls les chunks qui
+// contiennent des cellules vivantes (ou leurs voisins immédiats pendant une
+// étape) sont alloués, la mémoire est donc proportionnelle à la zone vivante.
+typedef struct {
+  Chunk **buckets;
+  int bucket_count;
+  Chunk **chunks; // Tableau dense des chunks actifs pour l'itération
+  int chunk_count;
+  int chunk_capacity;
+  Chunk *free_chunks; // Pool des chunks libérés, réutilisés avant malloc
+  int generation;
+  long population;
+  int view_row; // Coin supérieur gauche de la fenêtre affichée
+  int view_col;
+} InfiniteBoard;
+
+InfiniteBoard *create_infinite_board(void);
+void destroy_infinite_board(InfiniteBoard *board);
+State get_infinite_cell(InfiniteBoard *board, int row, int col);
+void set_infinite_cell(InfiniteBoard *board, int row, int col, State state);
+void import_infinite_board(InfiniteBoard *board, char *filename, int row,
+                           int col);
+void copy_infinite_region(InfiniteBoard *board, Board *view, int row, int col);
+int infinite_board_bounds(InfiniteBoard *board, int *min_row, int *min_col,
+                          int *max_row, int *max_col);
+void generate_next_infinite_cells(InfiniteBoard *board);
+void step_infinite_view(InfiniteBoard *board, Board *view);
+
+#endif
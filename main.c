@@ -1,7 +1,120 @@
+#include "distributed.h"
 #include "gameoflife_sdl.h"
+#include "infinite_board.h"
+#include "patterns.h"
+#include "stream.h"
+#include "terminal.h"
 #include "utilities.h"
+#include <signal.h>
+
+static volatile sig_atomic_t interrupted = 0;
+
+static void handle_interrupt(int signal_number) { interrupted = 1; }
+
+// Calcule la génération suivante, sur le plan infini (le plateau n'est alors
+// que la fenêtre affichée) ou sur les workers en mode réparti. Si un worker
+// s'est arrêté, la simulation continue localement (un worker bloqué mais
+// toujours en vie bloque en revanche la boucle). L'historique undo/redo
+// n'est conservé que si keep_history est vrai (affichage SDL), sinon il
+// grandirait sans limite.
+static void step_board(Board *board, Cluster **cluster, InfiniteBoard *infinite,
+                       int keep_history) {
+  if (infinite) {
+    step_infinite_view(infinite, board);
+    return;
+  }
+  if (*cluster) {
+    if (cluster_step(*cluster, board, 1, keep_history) == 0)
+      return;
+    fprintf(stderr, "Cluster step failed, running locally\n");
+    stop_cluster(*cluster);
+    *cluster = NULL;
+  }
+  if (keep_history)
+    generate_next_cells(board);
+  else
+    advance_board(board, 1);
+}
+
+// Boucle de simulation sans SDL, pour un usage à distance (SSH) : seules les
+// cellules modifiées sont réécrites à chaque génération. Ctrl-C pour quitter.
+static void run_terminal(Board *board, int speed, int braille,
+                         GenerationStream *stream, Cluster **cluster,
+                         InfiniteBoard *infinite) {
+  TerminalRenderer *renderer = create_terminal_renderer(board, braille);
+  if (!renderer) {
+    fprintf(stderr, "Failed to create terminal renderer\n");
+    return;
+  }
+  signal(SIGINT, handle_interrupt);
+
+  while (!interrupted) {
+    render_terminal(renderer, board);
+    if (stream)
+      stream_generation(stream, board);
+    sleep_ms(speed);
+    step_board(board, cluster, infinite, 0);
+  }
+
+  destroy_terminal_renderer(renderer);
+}
 
 int main(int argc, char *argv[]) {
+  // Options de la ligne de commande :
+  //   --stream <fichier|->  --every <N>  --xor : flux des générations
+  //   --lut : moteur de calcul à table (blocs 2x2)
+  //   --terminal, --braille : affichage dans le terminal au lieu de SDL
+  //   --tiles <L>x<C> : calcul réparti sur L x C processus workers
+  //   --infinite : plan infini, la grille n'est que la fenêtre affichée
+  const char *stream_path = NULL;
+  StreamFormat stream_format = STREAM_COORDS;
+  int stream_every = 1;
+  int terminal = 0;
+  int braille = 0;
+  int tile_rows = 0;
+  int tile_cols = 0;
+  int infinite_mode = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--stream") == 0 && i + 1 < argc) {
+      stream_path = argv[++i];
+    } else if (strcmp(argv[i], "--every") == 0 && i + 1 < argc) {
+      stream_every = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--xor") == 0) {
+      stream_format = STREAM_XOR;
+    } else if (strcmp(argv[i], "--lut") == 0) {
+      set_engine(ENGINE_LUT);
+    } else if (strcmp(argv[i], "--terminal") == 0) {
+      terminal = 1;
+    } else if (strcmp(argv[i], "--braille") == 0) {
+      terminal = 1;
+      braille = 1;
+    } else if (strcmp(argv[i], "--tiles") == 0 && i + 1 < argc &&
+               sscanf(argv[i + 1], "%dx%d", &tile_rows, &tile_cols) == 2) {
+      i++;
+    } else if (strcmp(argv[i], "--infinite") == 0) {
+      infinite_mode = 1;
+    } else {
+      fprintf(stderr, "Option inconnue : %s\n", argv[i]);
+      return 1;
+    }
+  }
+  if (infinite_mode && tile_rows > 0) {
+    fprintf(stderr, "--infinite et --tiles ne peuvent pas être combinés\n");
+    return 1;
+  }
+  // Le flux enregistre le plateau, qui n'est ici qu'une fenêtre recentrée au
+  // gré de la zone vivante : ses coordonnées n'auraient pas de sens
+  if (infinite_mode && stream_path) {
+    fprintf(stderr, "--infinite et --stream ne peuvent pas être combinés\n");
+    return 1;
+  }
+
+  // Flux vers la sortie standard : les questions et messages passent sur
+  // stderr dès maintenant pour ne pas précéder l'en-tête du flux
+  int stream_fd = -1;
+  if (stream_path && strcmp(stream_path, "-") == 0)
+    stream_fd = detach_stdout();
+
   // Demande des dimensions à l'utilisateur
   printf("Bienvenue dans le Jeu de la Vie!\n");
   printf("Veuillez choisir les dimensions de la grille.\n");
@@ -9,26 +122,27 @@ int main(int argc, char *argv[]) {
   int rows = get_valid_input(1, MAX_ROWS, "Nombre de lignes");
   int cols = get_valid_input(1, MAX_COLS, "Nombre de colonnes");
   char *glider = get_filename();
-  int speed = get_simulation_speed();
-
-  // Initialisation de SDL
-  SDLContext *sdl = init_sdl(rows, cols, speed);
-  if (!sdl) {
-    fprintf(stderr, "Failed to initialize SDL\n");
-    return 1;
+  int density = 0;
+  int seed = 0;
+  if (strcmp(glider, RANDOM_SOUP_FILE) == 0) {
+    density = get_valid_input(1, 100, "Densité de cellules vivantes en %");
+    seed = get_valid_input(0, 1000000000, "Graine du générateur");
   }
+  int speed = get_simulation_speed();
 
   // Création du plateau avec les dimensions choisies
   Board *board = create_board(rows, cols);
   if (!board) {
     fprintf(stderr, "Failed to create board\n");
-    cleanup_sdl(sdl);
     return 1;
   }
 
-  // Vérifier si le fichier existe et initialiser le board
-  FILE *test = fopen(glider, "r");
-  if (test != NULL) {
+  // Remplissage aléatoire reproductible si demandé, sinon vérifier si le
+  // fichier existe et initialiser le board
+  FILE *test = NULL;
+  if (density > 0) {
+    fill_random_region(board, 0, 0, rows, cols, density / 100.0, seed);
+  } else if ((test = fopen(glider, "r")) != NULL) {
     fclose(test);
     import_board(board, glider);
   } else {
@@ -43,6 +157,90 @@ int main(int argc, char *argv[]) {
     }
   }
 
+  // Plan infini : le motif initial y est recopié et le plateau ne sert plus
+  // qu'à afficher la fenêtre qui suit la zone vivante
+  InfiniteBoard *infinite = NULL;
+  if (infinite_mode) {
+    infinite = create_infinite_board();
+    if (!infinite) {
+      fprintf(stderr, "Failed to create infinite board\n");
+      destroy_board(board);
+      return 1;
+    }
+    for (int i = 0; i < rows; i++) {
+      for (int j = 0; j < cols; j++) {
+        if (board->cells[i][j].state == ALIVE)
+          set_infinite_cell(infinite, i, j, ALIVE);
+      }
+    }
+    copy_infinite_region(infinite, board, 0, 0);
+  }
+
+  // Workers du mode réparti, lancés avant SDL et le thread d'écriture du flux
+  // pour que le fork se fasse tant que le programme n'a qu'un seul thread
+  Cluster *cluster = NULL;
+  if (tile_rows > 0) {
+    cluster = start_cluster(board, tile_rows, tile_cols);
+    if (!cluster) {
+      destroy_board(board);
+      return 1;
+    }
+  }
+
+  // Initialisation de SDL (inutile en mode terminal)
+  SDLContext *sdl = NULL;
+  if (!terminal) {
+    sdl = init_sdl(rows, cols, speed);
+    if (!sdl) {
+      fprintf(stderr, "Failed to initialize SDL\n");
+      if (cluster)
+        stop_cluster(cluster);
+      if (infinite)
+        destroy_infinite_board(infinite);
+      destroy_board(board);
+      return 1;
+    }
+  }
+
+  // Flux des générations pour les outils d'analyse externes
+  GenerationStream *stream = NULL;
+  if (stream_path) {
+    stream = open_stream(stream_path, stream_fd, stream_format,
+                         stream_every, board);
+    if (!stream) {
+      if (cluster)
+        stop_cluster(cluster);
+      if (infinite)
+        destroy_infinite_board(infinite);
+      destroy_board(board);
+      if (sdl)
+        cleanup_sdl(sdl);
+      return 1;
+    }
+  }
+
+  if (terminal) {
+    run_terminal(board, speed, braille, stream, &cluster, infinite);
+    if (cluster)
+      stop_cluster(cluster);
+    if (stream)
+      close_stream(stream);
+    if (infinite)
+      destroy_infinite_board(infinite);
+    destroy_board(board);
+    return 0;
+  }
+
+  // Ligne temporelle pour le saut direct à une génération (sans objet sur le
+  // plan infini, dont le plateau n'a pas d'historique)
+  Timeline *timeline = NULL;
+  if (infinite) {
+    sdl->infinite = infinite;
+  } else {
+    timeline = create_timeline(board);
+    sdl->timeline = timeline;
+  }
+
   // Affichage des commandes dans le terminal pour l'utilisateur
   printf("\nCommandes:\n");
   printf("- ESPACE : Pause/Reprise\n");
@@ -52,6 +250,8 @@ int main(int argc, char *argv[]) {
   printf("- Q (en pause) : Génération précédente\n");
   printf("- D (en pause) : Génération suivante\n");
   printf("- S (en pause) : Sauvegarder l'état actuel\n");
+  printf("- G : Aller à une génération (saisir le numéro puis Entrée)\n");
+  printf("- Clic sur la barre du bas : Parcourir l'historique\n");
   printf("\nAppuyez sur Entrée pour commencer...");
   while (getchar() != '\n')
     ;
@@ -64,15 +264,27 @@ int main(int argc, char *argv[]) {
 
     handle_events(sdl, board);
     render_board(sdl, board);
+    if (stream)
+      stream_generation(stream, board);
 
     if (!sdl->paused && currentTime - lastTime >= sdl->simulation_speed) {
-      generate_next_cells(board);
+      step_board(board, &cluster, infinite, 1);
+      if (timeline)
+        timeline_record(timeline, board);
       lastTime = currentTime;
     }
 
     SDL_Delay(1);
   }
 
+  if (cluster)
+    stop_cluster(cluster);
+  if (stream)
+    close_stream(stream);
+  if (timeline)
+    destroy_timeline(timeline, board);
+  if (infinite)
+    destroy_infinite_board(infinite);
   destroy_board(board);
   cleanup_sdl(sdl);
   return 0;
@@ -1,9 +1,9 @@
-CFLAGS = -Wall
-LDFLAGS = -lSDL2 -lSDL2_ttf
+CFLAGS = -Wall -pthread
+LDFLAGS = -lSDL2 -lSDL2_ttf -pthread
 
 all: gameoflife
 
-gameoflife: main.o gameoflife.o gameoflife_sdl.o utilities.o
+gameoflife: main.o gameoflife.o gameoflife_sdl.o utilities.o infinite_board.o pool.o timeline.o patterns.o stream.o terminal.o distributed.o
 	$(CC) $^ -o $@ $(LDFLAGS)
 
 %.o: %.c
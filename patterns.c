@@ -0,0 +1,251 @@
+#include "patterns.h"
+
+typedef struct {
+  Board *board;
+  int row_start;
+  int row_end;
+  int col_start;
+  int col_end;
+  unsigned long long threshold; // density * 2^53
+  unsigned long long seed;
+} FillTask;
+
+// Mélangeur splitmix64 : l'état d'une cellule ne dépend que de la graine et
+// de ses coordonnées, le résultat est donc identique quel que soit le nombre
+// de threads ou le découpage en bandes
+static unsigned long long mix(unsigned long long x) {
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+static void *fill_band(void *arg) {
+  FillTask *task = arg;
+  for (int i = task->row_start; i < task->row_end; i++) {
+    unsigned long long row_seed = mix(task->seed ^ (unsigned long long)i);
+    Cell *cells = task->board->cells[i];
+    for (int j = task->col_start; j < task->col_end; j++) {
+      unsigned long long value = mix(row_seed + (unsigned long long)j) >> 11;
+      cells[j].state = (value < task->threshold) ? ALIVE : DEAD;
+    }
+  }
+  return NULL;
+}
+
+// Remplit aléatoirement la région (row, col, rows, cols) avec une proportion
+// density de cellules vivantes. La région est découpée en bandes de lignes
+// traitées en parallèle.
+void fill_random_region(Board *board, int row, int col, int rows, int cols,
+                        double density, unsigned long long seed) {
+  // On restreint la région au plateau
+  int row_end = row + rows;
+  int col_end = col + cols;
+  if (row < 0)
+    row = 0;
+  if (col < 0)
+    col = 0;
+  if (row_end > board->rows)
+    row_end = board->rows;
+  if (col_end > board->cols)
+    col_end = board->cols;
+  if (row >= row_end || col >= col_end)
+    return;
+
+  if (density < 0.0)
+    density = 0.0;
+  if (density > 1.0)
+    density = 1.0;
+  unsigned long long threshold =
+      (unsigned long long)(density * (double)(1ULL << 53));
+
+  int band_count = (row_end - row) / RANDOM_FILL_MIN_ROWS;
+  if (band_count > RANDOM_FILL_THREADS)
+    band_count = RANDOM_FILL_THREADS;
+  if (band_count < 1)
+    band_count = 1;
+
+  FillTask tasks[RANDOM_FILL_THREADS];
+  pthread_t threads[RANDOM_FILL_THREADS];
+  int started[RANDOM_FILL_THREADS] = {0};
+  int band_rows = (row_end - row + band_count - 1) / band_count;
+
+  for (int n = 0; n < band_count; n++) {
+    tasks[n].board = board;
+    tasks[n].row_start = row + n * band_rows;
+    tasks[n].row_end = tasks[n].row_start + band_rows;
+    if (tasks[n].row_end > row_end)
+      tasks[n].row_end = row_end;
+    tasks[n].col_start = col;
+    tasks[n].col_end = col_end;
+    tasks[n].threshold = threshold;
+    tasks[n].seed = seed;
+
+    // La première bande est traitée par le thread appelant ; si un thread
+    // ne peut pas être créé, sa bande est traitée plus bas de la même façon
+    if (n > 0)
+      started[n] = pthread_create(&threads[n], NULL, fill_band, &tasks[n]) == 0;
+  }
+
+  fill_band(&tasks[0]);
+  for (int n = 1; n < band_count; n++) {
+    if (started[n]) {
+      pthread_join(threads[n], NULL);
+    } else {
+      fill_band(&tasks[n]);
+    }
+  }
+}
+
+static Pattern *create_pattern(int rows, int cols) {
+  Pattern *pattern = malloc(sizeof(Pattern));
+  if (!pattern)
+    return NULL;
+  pattern->rows = rows;
+  pattern->cols = cols;
+  pattern->cells = malloc((size_t)rows * cols * sizeof(Cell));
+  if (!pattern->cells && rows * cols > 0) {
+    free(pattern);
+    return NULL;
+  }
+  for (int n = 0; n < rows * cols; n++) {
+    pattern->cells[n].state = DEAD;
+  }
+  return pattern;
+}
+
+void destroy_pattern(Pattern *pattern) {
+  free(pattern->cells);
+  free(pattern);
+}
+
+// Importe un motif au même format que import_board ('O' vivant, '.' mort).
+// Contrairement à import_board, les dimensions sont celles du fichier : la
+// ligne la plus longue donne la largeur, les lignes plus courtes sont
+// complétées par des cellules mortes.
+Pattern *import_pattern(char *filename) {
+  FILE *file = fopen(filename, "r");
+  if (file == NULL) {
+    printf("Error: File not found\n");
+    return NULL;
+  }
+
+  // Premier passage : dimensions du motif
+  int rows = 0;
+  int cols = 0;
+  int length = 0;
+  int c;
+  while ((c = fgetc(file)) != EOF) {
+    if (c == 'O' || c == '.') {
+      length++;
+    } else if (c == '\n') {
+      if (length > 0)
+        rows++;
+      if (length > cols)
+        cols = length;
+      length = 0;
+    }
+  }
+  if (length > 0)
+    rows++;
+  if (length > cols)
+    cols = length;
+
+  Pattern *pattern = create_pattern(rows, cols);
+  if (!pattern) {
+    fclose(file);
+    return NULL;
+  }
+
+  // Second passage : cellules vivantes
+  rewind(file);
+  int i = 0;
+  int j = 0;
+  while ((c = fgetc(file)) != EOF) {
+    if (c == 'O' || c == '.') {
+      if (c == 'O')
+        pattern->cells[i * cols + j].state = ALIVE;
+      j++;
+    } else if (c == '\n' && j > 0) {
+      i++;
+      j = 0;
+    }
+  }
+  fclose(file);
+  return pattern;
+}
+
+// Retourne une copie du motif dans l'orientation demandée
+Pattern *orient_pattern(Pattern *pattern, Orientation orientation) {
+  int rotation = orientation % 4;
+  int flip = orientation >= FLIP_0;
+  int rows = (rotation % 2) ? pattern->cols : pattern->rows;
+  int cols = (rotation % 2) ? pattern->rows : pattern->cols;
+
+  Pattern *oriented = create_pattern(rows, cols);
+  if (!oriented)
+    return NULL;
+
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      // Coordonnées dans le motif source après rotation inverse
+      int src_i, src_j;
+      switch (rotation) {
+      case 1:
+        src_i = pattern->rows - 1 - j;
+        src_j = i;
+        break;
+      case 2:
+        src_i = pattern->rows - 1 - i;
+        src_j = pattern->cols - 1 - j;
+        break;
+      case 3:
+        src_i = j;
+        src_j = pattern->cols - 1 - i;
+        break;
+      default:
+        src_i = i;
+        src_j = j;
+        break;
+      }
+      if (flip)
+        src_j = pattern->cols - 1 - src_j;
+      oriented->cells[i * cols + j] =
+          pattern->cells[src_i * pattern->cols + src_j];
+    }
+  }
+  return oriented;
+}
+
+// Copie le motif sur le plateau avec son coin supérieur gauche en (row, col),
+// cellules mortes comprises. Les parties hors du plateau sont ignorées. Pour
+// poser de nombreuses copies dans une même orientation, il est plus rapide
+// d'appeler orient_pattern une fois puis stamp_pattern avec ROTATE_0.
+void stamp_pattern(Board *board, Pattern *pattern, int row, int col,
+                   Orientation orientation) {
+  Pattern *oriented = pattern;
+  if (orientation != ROTATE_0) {
+    oriented = orient_pattern(pattern, orientation);
+    if (!oriented)
+      return;
+  }
+
+  int col_start = (col < 0) ? -col : 0;
+  int col_end = oriented->cols;
+  if (col + col_end > board->cols)
+    col_end = board->cols - col;
+
+  if (col_start < col_end) {
+    for (int i = 0; i < oriented->rows; i++) {
+      int board_row = row + i;
+      if (board_row < 0 || board_row >= board->rows)
+        continue;
+      memcpy(&board->cells[board_row][col + col_start],
+             &oriented->cells[i * oriented->cols + col_start],
+             (col_end - col_start) * sizeof(Cell));
+    }
+  }
+
+  if (oriented != pattern)
+    destroy_pattern(oriented);
+}
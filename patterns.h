@@ -0,0 +1,41 @@
+#ifndef PATTERNS_H
+#define PATTERNS_H
+
+#include "gameoflife.h"
+#include <pthread.h>
+
+// Nombre maximum de threads pour le remplissage aléatoire, chaque thread
+// traitant au moins RANDOM_FILL_MIN_ROWS lignes
+#define RANDOM_FILL_THREADS 8
+#define RANDOM_FILL_MIN_ROWS 32
+
+// Motif importé, de la taille exacte de son fichier. Les cellules sont
+// stockées ligne par ligne pour pouvoir être copiées directement.
+typedef struct {
+  int rows;
+  int cols;
+  Cell *cells;
+} Pattern;
+
+// Orientations possibles d'un motif : rotations dans le sens horaire, puis
+// les mêmes rotations appliquées au motif retourné horizontalement
+typedef enum {
+  ROTATE_0,
+  ROTATE_90,
+  ROTATE_180,
+  ROTATE_270,
+  FLIP_0,
+  FLIP_90,
+  FLIP_180,
+  FLIP_270
+} Orientation;
+
+void fill_random_region(Board *board, int row, int col, int rows, int cols,
+                        double density, unsigned long long seed);
+Pattern *import_pattern(char *filename);
+Pattern *orient_pattern(Pattern *pattern, Orientation orientation);
+void destroy_pattern(Pattern *pattern);
+void stamp_pattern(Board *board, Pattern *pattern, int row, int col,
+                   Orientation orientation);
+
+#endif
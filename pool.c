@@ -0,0 +1,134 @@
+#include "pool.h"
+
+BoardPool *create_pool(int rows, int cols) {
+  BoardPool *pool = malloc(sizeof(BoardPool));
+  if (!pool)
+    return NULL;
+  pool->rows = rows;
+  pool->cols = cols;
+  pool->free_grids = NULL;
+  pool->free_grid_count = 0;
+  pool->free_grid_capacity = 0;
+  pool->free_nodes = NULL;
+  pool->free_node_count = 0;
+  pool->free_node_capacity = 0;
+  pool->blocks = NULL;
+  pool->block_count = 0;
+  pool->block_capacity = 0;
+  return pool;
+}
+
+// Libère tous les blocs d'un coup : les grilles et noeuds encore utilisés
+// (plateau courant, historique) disparaissent avec eux, sans parcours
+void destroy_pool(BoardPool *pool) {
+  for (int i = 0; i < pool->block_count; i++) {
+    free(pool->blocks[i]);
+  }
+  free(pool->blocks);
+  free(pool->free_grids);
+  free(pool->free_nodes);
+  free(pool);
+}
+
+// Alloue un bloc et l'enregistre pour destroy_pool
+static void *allocate_block(BoardPool *pool, size_t size) {
+  if (pool->block_count == pool->block_capacity) {
+    int capacity = pool->block_capacity ? pool->block_capacity * 2 : 8;
+    void **blocks = realloc(pool->blocks, capacity * sizeof(void *));
+    if (!blocks)
+      return NULL;
+    pool->blocks = blocks;
+    pool->block_capacity = capacity;
+  }
+  void *block = malloc(size);
+  if (block)
+    pool->blocks[pool->block_count++] = block;
+  return block;
+}
+
+// La capacité des piles suit le nombre total d'éléments alloués, ce qui
+// garantit qu'un retour au pool ne peut jamais échouer
+static int reserve(void **stack, int *capacity, int needed, size_t size) {
+  if (needed <= *capacity)
+    return 1;
+  void *grown = realloc(*stack, needed * size);
+  if (!grown)
+    return 0;
+  *stack = grown;
+  *capacity = needed;
+  return 1;
+}
+
+Cell **pool_acquire_grid(BoardPool *pool) {
+  if (pool->free_grid_count == 0) {
+    // Un seul bloc contient les tableaux de lignes puis les cellules de
+    // plusieurs grilles, chaque grille étant contiguë en mémoire. Pour les
+    // grandes grilles, le bloc est limité à POOL_BLOCK_BYTES.
+    size_t row_bytes = pool->rows * sizeof(Cell *);
+    size_t cell_bytes = (size_t)pool->rows * pool->cols * sizeof(Cell);
+    int count = POOL_BLOCK_BYTES / (row_bytes + cell_bytes);
+    if (count > POOL_BLOCK_SIZE)
+      count = POOL_BLOCK_SIZE;
+    if (count < 1)
+      count = 1;
+
+    if (!reserve((void **)&pool->free_grids, &pool->free_grid_capacity,
+                 pool->free_grid_capacity + count, sizeof(Cell **)))
+      return NULL;
+    char *block = allocate_block(pool, count * (row_bytes + cell_bytes));
+    if (!block)
+      return NULL;
+
+    Cell *cells = (Cell *)(block + count * row_bytes);
+    for (int n = 0; n < count; n++) {
+      Cell **grid = (Cell **)(block + n * row_bytes);
+      for (int i = 0; i < pool->rows; i++) {
+        grid[i] = cells + ((size_t)n * pool->rows + i) * pool->cols;
+      }
+      pool->free_grids[pool->free_grid_count++] = grid;
+    }
+  }
+  return pool->free_grids[--pool->free_grid_count];
+}
+
+void pool_release_grid(BoardPool *pool, Cell **grid) {
+  pool->free_grids[pool->free_grid_count++] = grid;
+}
+
+// Retourne un noeud d'historique avec sa propre grille (non initialisée)
+Board *pool_acquire_node(BoardPool *pool) {
+  if (pool->free_node_count == 0) {
+    if (!reserve((void **)&pool->free_nodes, &pool->free_node_capacity,
+                 pool->free_node_capacity + POOL_BLOCK_SIZE, sizeof(Board *)))
+      return NULL;
+
+    Board *nodes = allocate_block(pool, POOL_BLOCK_SIZE * sizeof(Board));
+    if (!nodes)
+      return NULL;
+    for (int n = 0; n < POOL_BLOCK_SIZE; n++) {
+      pool->free_nodes[pool->free_node_count++] = &nodes[n];
+    }
+  }
+
+  Cell **grid = pool_acquire_grid(pool);
+  if (!grid)
+    return NULL;
+
+  Board *node = pool->free_nodes[--pool->free_node_count];
+  node->rows = pool->rows;
+  node->cols = pool->cols;
+  node->cells = grid;
+  node->generation = 0;
+  node->prev = NULL;
+  node->next = NULL;
+  node->pool = pool;
+  return node;
+}
+
+// Rend le noeud et sa grille au pool
+void pool_release_node(BoardPool *pool, Board *node) {
+  if (node->cells)
+    pool_release_grid(pool, node->cells);
+  node->cells = NULL;
+  pool->free_nodes[pool->free_node_count++] = node;
+}
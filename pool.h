@@ -0,0 +1,35 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include "gameoflife.h"
+
+// Nombre de grilles (ou de noeuds) allouées d'un coup quand le pool est vide
+#define POOL_BLOCK_SIZE 16
+// Taille maximale d'un bloc de grilles (au moins une grille par bloc)
+#define POOL_BLOCK_BYTES (8 * 1024 * 1024)
+
+// Pool de grilles de taille fixe (rows x cols) et de noeuds d'historique.
+// Les éléments rendus au pool sont recyclés au lieu d'être libérés, et toute
+// la mémoire est rendue au système en une fois par destroy_pool.
+typedef struct BoardPool {
+  int rows;
+  int cols;
+  Cell ***free_grids; // Pile des grilles disponibles
+  int free_grid_count;
+  int free_grid_capacity;
+  Board **free_nodes; // Pile des noeuds d'historique disponibles
+  int free_node_count;
+  int free_node_capacity;
+  void **blocks; // Blocs alloués, libérés uniquement par destroy_pool
+  int block_count;
+  int block_capacity;
+} BoardPool;
+
+BoardPool *create_pool(int rows, int cols);
+void destroy_pool(BoardPool *pool);
+Cell **pool_acquire_grid(BoardPool *pool);
+void pool_release_grid(BoardPool *pool, Cell **grid);
+Board *pool_acquire_node(BoardPool *pool);
+void pool_release_node(BoardPool *pool, Board *node);
+
+#endif
@@ -0,0 +1,244 @@
+#include "stream.h"
+
+// Thread d'écriture : vide la file et écrit les enregistrements, pour que la
+// simulation ne soit jamais bloquée par un disque ou un tube lent
+static void *write_records(void *arg) {
+  GenerationStream *stream = arg;
+
+  pthread_mutex_lock(&stream->lock);
+  for (;;) {
+    while (!stream->head && !stream->closing) {
+      pthread_cond_wait(&stream->ready, &stream->lock);
+    }
+    if (!stream->head)
+      break; // Fermeture demandée et file vide
+
+    // On prend toute la file d'un coup et on écrit sans tenir le verrou
+    StreamRecord *record = stream->head;
+    stream->head = NULL;
+    stream->tail = NULL;
+    pthread_mutex_unlock(&stream->lock);
+
+    size_t written = 0;
+    while (record) {
+      StreamRecord *next = record->next;
+      fwrite(record->data, 1, record->length, stream->file);
+      written += record->length;
+      free(record);
+      record = next;
+    }
+    fflush(stream->file);
+
+    pthread_mutex_lock(&stream->lock);
+    stream->pending -= written;
+    pthread_cond_signal(&stream->drained);
+  }
+  pthread_mutex_unlock(&stream->lock);
+  return NULL;
+}
+
+static StreamRecord *create_record(size_t capacity) {
+  StreamRecord *record = malloc(sizeof(StreamRecord) + capacity);
+  if (record) {
+    record->next = NULL;
+    record->length = 0;
+  }
+  return record;
+}
+
+static void enqueue_record(GenerationStream *stream, StreamRecord *record) {
+  pthread_mutex_lock(&stream->lock);
+  while (stream->pending > STREAM_MAX_PENDING) {
+    pthread_cond_wait(&stream->drained, &stream->lock);
+  }
+  if (stream->tail) {
+    stream->tail->next = record;
+  } else {
+    stream->head = record;
+  }
+  stream->tail = record;
+  stream->pending += record->length;
+  pthread_cond_signal(&stream->ready);
+  pthread_mutex_unlock(&stream->lock);
+}
+
+// Redirige stdout vers stderr pour que les messages du programme ne se mêlent
+// pas aux enregistrements d'un flux vers la sortie standard. A appeler avant
+// le premier affichage, retourne le descripteur de la sortie d'origine (ou -1).
+int detach_stdout(void) {
+  fflush(stdout);
+  int fd = dup(fileno(stdout));
+  if (fd >= 0)
+    dup2(fileno(stderr), fileno(stdout));
+  return fd;
+}
+
+// Ouvre un flux vers path, ou vers stdout_fd (obtenu par detach_stdout) si
+// path vaut "-"
+GenerationStream *open_stream(const char *path, int stdout_fd,
+                              StreamFormat format, int every, Board *board) {
+  GenerationStream *stream = malloc(sizeof(GenerationStream));
+  if (!stream)
+    return NULL;
+
+  if (strcmp(path, "-") == 0) {
+    stream->file = (stdout_fd >= 0) ? fdopen(stdout_fd, "wb") : NULL;
+  } else {
+    stream->file = fopen(path, "wb");
+  }
+  if (!stream->file) {
+    printf("Error: cannot open stream %s\n", path);
+    free(stream);
+    return NULL;
+  }
+
+  stream->format = format;
+  stream->every = (every > 0) ? every : 1;
+  stream->rows = board->rows;
+  stream->cols = board->cols;
+  stream->last_generation = -1;
+  stream->last = calloc((size_t)board->rows * board->cols, 1);
+  stream->head = NULL;
+  stream->tail = NULL;
+  stream->pending = 0;
+  stream->closing = 0;
+  pthread_mutex_init(&stream->lock, NULL);
+  pthread_cond_init(&stream->ready, NULL);
+  pthread_cond_init(&stream->drained, NULL);
+
+  if (!stream->last ||
+      pthread_create(&stream->writer, NULL, write_records, stream) != 0) {
+    printf("Error: cannot start stream writer\n");
+    pthread_mutex_destroy(&stream->lock);
+    pthread_cond_destroy(&stream->ready);
+    pthread_cond_destroy(&stream->drained);
+    fclose(stream->file);
+    free(stream->last);
+    free(stream);
+    return NULL;
+  }
+
+  StreamRecord *header = create_record(96);
+  if (header) {
+    header->length = snprintf(header->data, 96,
+                              "# gameoflife stream %d %d %s\n", board->rows,
+                              board->cols,
+                              format == STREAM_XOR ? "xor" : "coords");
+    enqueue_record(stream, header);
+  }
+  return stream;
+}
+
+// Ajoute " <value>" à la fin de l'enregistrement (plus rapide que snprintf)
+static void append_int(StreamRecord *record, int value) {
+  char digits[12];
+  int count = 0;
+  do {
+    digits[count++] = '0' + value % 10;
+    value /= 10;
+  } while (value > 0);
+  record->data[record->length++] = ' ';
+  while (count > 0) {
+    record->data[record->length++] = digits[--count];
+  }
+}
+
+static StreamRecord *encode_coords(GenerationStream *stream, Board *board) {
+  // Premier passage : nombre de changements pour dimensionner l'enregistrement
+  size_t changes = 0;
+  for (int i = 0; i < board->rows; i++) {
+    unsigned char *last = stream->last + (size_t)i * board->cols;
+    for (int j = 0; j < board->cols; j++) {
+      changes += last[j] != (board->cells[i][j].state == ALIVE);
+    }
+  }
+
+  // Au plus 2 entiers de 11 caractères (espace compris) par changement
+  StreamRecord *record = create_record(changes * 22 + 32);
+  if (!record)
+    return NULL;
+  record->length = snprintf(record->data, 32, "G %d\n", board->generation);
+
+  // Naissances puis morts, en mettant à jour le dernier état émis au passage
+  // des morts (les naissances doivent encore être visibles à ce moment-là)
+  for (int pass = 0; pass < 2; pass++) {
+    record->data[record->length++] = pass == 0 ? 'B' : 'D';
+    for (int i = 0; i < board->rows; i++) {
+      unsigned char *last = stream->last + (size_t)i * board->cols;
+      for (int j = 0; j < board->cols; j++) {
+        unsigned char alive = board->cells[i][j].state == ALIVE;
+        if (last[j] == alive)
+          continue;
+        if (alive == (pass == 0)) {
+          append_int(record, i);
+          append_int(record, j);
+        }
+        if (pass == 1)
+          last[j] = alive;
+      }
+    }
+    record->data[record->length++] = '\n';
+  }
+  return record;
+}
+
+static StreamRecord *encode_xor(GenerationStream *stream, Board *board) {
+  size_t cells = (size_t)board->rows * board->cols;
+  StreamRecord *record = create_record(4 + (cells + 7) / 8);
+  if (!record)
+    return NULL;
+
+  unsigned int generation = (unsigned int)board->generation;
+  for (int n = 0; n < 4; n++) {
+    record->data[n] = (char)((generation >> (8 * n)) & 0xFF);
+  }
+  unsigned char *bits = (unsigned char *)record->data + 4;
+  memset(bits, 0, (cells + 7) / 8);
+
+  size_t index = 0;
+  for (int i = 0; i < board->rows; i++) {
+    for (int j = 0; j < board->cols; j++, index++) {
+      unsigned char alive = board->cells[i][j].state == ALIVE;
+      if (stream->last[index] != alive) {
+        bits[index / 8] |= 1 << (index % 8);
+        stream->last[index] = alive;
+      }
+    }
+  }
+  record->length = 4 + (cells + 7) / 8;
+  return record;
+}
+
+// A appeler après chaque changement de génération. Seul l'encodage se fait
+// sur le thread appelant, l'écriture est confiée au thread d'écriture.
+void stream_generation(GenerationStream *stream, Board *board) {
+  if (board->generation == stream->last_generation ||
+      board->generation % stream->every != 0)
+    return;
+  if (board->rows != stream->rows || board->cols != stream->cols)
+    return; // Le plateau a été redimensionné : le flux n'est plus valide
+
+  StreamRecord *record = (stream->format == STREAM_XOR)
+                             ? encode_xor(stream, board)
+                             : encode_coords(stream, board);
+  if (!record)
+    return;
+  stream->last_generation = board->generation;
+  enqueue_record(stream, record);
+}
+
+// Attend l'écriture de tous les enregistrements puis ferme le flux
+void close_stream(GenerationStream *stream) {
+  pthread_mutex_lock(&stream->lock);
+  stream->closing = 1;
+  pthread_cond_signal(&stream->ready);
+  pthread_mutex_unlock(&stream->lock);
+  pthread_join(stream->writer, NULL);
+
+  pthread_mutex_destroy(&stream->lock);
+  pthread_cond_destroy(&stream->ready);
+  pthread_cond_destroy(&stream->drained);
+  fclose(stream->file);
+  free(stream->last);
+  free(stream);
+}
@@ -0,0 +1,56 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include "gameoflife.h"
+#include <pthread.h>
+
+// Au-delà de ce volume en attente d'écriture, la simulation attend que le
+// thread d'écriture rattrape son retard plutôt que de consommer toute la
+// mémoire
+#define STREAM_MAX_PENDING (64 * 1024 * 1024)
+
+// Formats d'enregistrement d'une génération, par rapport à la dernière
+// génération émise (le premier enregistrement part d'un plateau vide) :
+// - STREAM_COORDS : texte, trois lignes par génération
+//     G <génération>
+//     B <ligne> <colonne> ... (naissances)
+//     D <ligne> <colonne> ... (morts)
+// - STREAM_XOR : binaire, génération sur 4 octets little-endian puis
+//   (rows * cols + 7) / 8 octets de masque XOR, ligne par ligne, bit de poids
+//   faible en premier
+// Le flux commence par la ligne "# gameoflife stream <rows> <cols> <format>".
+typedef enum { STREAM_COORDS, STREAM_XOR } StreamFormat;
+
+typedef struct StreamRecord {
+  struct StreamRecord *next;
+  size_t length;
+  char data[];
+} StreamRecord;
+
+typedef struct {
+  FILE *file;
+  StreamFormat format;
+  int every; // N'émet qu'une génération sur every
+  int rows;
+  int cols;
+  unsigned char *last; // Dernier état émis, un octet par cellule
+  int last_generation;
+
+  // File d'attente vers le thread d'écriture
+  pthread_t writer;
+  pthread_mutex_t lock;
+  pthread_cond_t ready;   // Des enregistrements sont disponibles
+  pthread_cond_t drained; // De la place s'est libérée dans la file
+  StreamRecord *head;
+  StreamRecord *tail;
+  size_t pending;
+  int closing;
+} GenerationStream;
+
+int detach_stdout(void);
+GenerationStream *open_stream(const char *path, int stdout_fd,
+                              StreamFormat format, int every, Board *board);
+void stream_generation(GenerationStream *stream, Board *board);
+void close_stream(GenerationStream *stream);
+
+#endif
@@ -0,0 +1,149 @@
+#include "terminal.h"
+
+// Couleurs ANSI utilisées, identiques à print_board
+#define COLOR_ALIVE "\033[32m"
+#define COLOR_DEAD "\033[38;5;240m"
+#define COLOR_RESET "\033[0m"
+
+TerminalRenderer *create_terminal_renderer(Board *board, int braille) {
+  TerminalRenderer *renderer = malloc(sizeof(TerminalRenderer));
+  if (!renderer)
+    return NULL;
+  renderer->braille = braille;
+  renderer->rows = braille ? (board->rows + 3) / 4 : board->rows;
+  renderer->cols = braille ? (board->cols + 1) / 2 : board->cols;
+  renderer->previous = calloc((size_t)renderer->rows * renderer->cols, 1);
+  renderer->first_frame = 1;
+  renderer->capacity = TERMINAL_BUFFER_SIZE;
+  renderer->buffer = malloc(renderer->capacity);
+  renderer->length = 0;
+  if (!renderer->previous || !renderer->buffer) {
+    free(renderer->previous);
+    free(renderer->buffer);
+    free(renderer);
+    return NULL;
+  }
+  return renderer;
+}
+
+// Réaffiche le curseur et place l'invite sous le plateau
+void destroy_terminal_renderer(TerminalRenderer *renderer) {
+  printf(COLOR_RESET "\033[%d;1H\033[?25h", renderer->rows + 3);
+  fflush(stdout);
+  free(renderer->previous);
+  free(renderer->buffer);
+  free(renderer);
+}
+
+static void append(TerminalRenderer *renderer, const char *data, size_t size) {
+  if (renderer->length + size > renderer->capacity) {
+    size_t capacity = renderer->capacity;
+    while (renderer->length + size > capacity) {
+      capacity *= 2;
+    }
+    char *buffer = realloc(renderer->buffer, capacity);
+    if (!buffer)
+      return;
+    renderer->buffer = buffer;
+    renderer->capacity = capacity;
+  }
+  memcpy(renderer->buffer + renderer->length, data, size);
+  renderer->length += size;
+}
+
+static void append_string(TerminalRenderer *renderer, const char *text) {
+  append(renderer, text, strlen(text));
+}
+
+// Positionne le curseur (coordonnées du terminal, à partir de 1)
+static void move_cursor(TerminalRenderer *renderer, int row, int col) {
+  char sequence[32];
+  int length = snprintf(sequence, sizeof(sequence), "\033[%d;%dH", row, col);
+  append(renderer, sequence, length);
+}
+
+// Motif braille du bloc de 2x4 cellules commençant en (row, col)
+static unsigned char braille_dots(Board *board, int row, int col) {
+  // Numérotation Unicode des points : colonne de gauche 1, 2, 3, 7 et
+  // colonne de droite 4, 5, 6, 8 (de haut en bas)
+  static const unsigned char dots[4][2] = {
+      {0x01, 0x08}, {0x02, 0x10}, {0x04, 0x20}, {0x40, 0x80}};
+  unsigned char value = 0;
+  for (int i = 0; i < 4 && row + i < board->rows; i++) {
+    for (int j = 0; j < 2 && col + j < board->cols; j++) {
+      if (board->cells[row + i][col + j].state == ALIVE)
+        value |= dots[i][j];
+    }
+  }
+  return value;
+}
+
+// Affiche la génération courante et retourne le nombre de cellules vivantes
+int render_terminal(TerminalRenderer *renderer, Board *board) {
+  renderer->length = 0;
+  if (renderer->first_frame) {
+    // Efface l'écran et masque le curseur
+    append_string(renderer, "\033[2J\033[?25l");
+  }
+
+  int alive_cells = 0;
+  int cursor_row = -1; // Position du curseur après la dernière écriture
+  int cursor_col = -1;
+  int color = -1; // Couleur active : 1 vivante, 0 morte, -1 inconnue
+
+  for (int i = 0; i < renderer->rows; i++) {
+    for (int j = 0; j < renderer->cols; j++) {
+      unsigned char value;
+      if (renderer->braille) {
+        value = braille_dots(board, i * 4, j * 2);
+        for (unsigned char dots = value; dots; dots &= dots - 1) {
+          alive_cells++;
+        }
+      } else {
+        value = board->cells[i][j].state == ALIVE;
+        alive_cells += value;
+      }
+
+      unsigned char *previous = &renderer->previous[i * renderer->cols + j];
+      if (!renderer->first_frame && *previous == value)
+        continue;
+      *previous = value;
+
+      // On ne repositionne le curseur que si la cellule ne suit pas
+      // directement la précédente écrite
+      if (cursor_row != i || cursor_col != j)
+        move_cursor(renderer, i + 1, j + 1);
+
+      if (renderer->braille) {
+        if (color != 1) {
+          append_string(renderer, COLOR_ALIVE);
+          color = 1;
+        }
+        // U+2800 + motif, encodé en UTF-8 sur 3 octets
+        char glyph[3] = {(char)0xE2, (char)(0xA0 | (value >> 6)),
+                         (char)(0x80 | (value & 0x3F))};
+        append(renderer, glyph, sizeof(glyph));
+      } else {
+        if (color != value) {
+          append_string(renderer, value ? COLOR_ALIVE : COLOR_DEAD);
+          color = value;
+        }
+        append_string(renderer, "■");
+      }
+      cursor_row = i;
+      cursor_col = j + 1;
+    }
+  }
+
+  char status[96];
+  int length = snprintf(status, sizeof(status),
+                        "\033[%d;1H\033[33mGeneration: %d | Vivantes: %d"
+                        "\033[0m\033[K",
+                        renderer->rows + 2, board->generation, alive_cells);
+  append(renderer, status, length);
+
+  fwrite(renderer->buffer, 1, renderer->length, stdout);
+  fflush(stdout);
+  renderer->first_frame = 0;
+  return alive_cells;
+}
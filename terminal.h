@@ -0,0 +1,28 @@
+#ifndef TERMINAL_H
+#define TERMINAL_H
+
+#include "gameoflife.h"
+
+#define TERMINAL_BUFFER_SIZE 4096
+
+// Rendu terminal incrémental : seul le premier affichage dessine tout le
+// plateau, ensuite seules les positions qui ont changé sont réécrites (avec
+// des séquences de positionnement du curseur). Chaque image est construite
+// dans un seul buffer, écrit en une fois.
+// En mode braille, chaque caractère représente un bloc de 2x4 cellules.
+typedef struct {
+  int rows; // Dimensions de l'affichage, en caractères
+  int cols;
+  int braille;
+  unsigned char *previous; // Image précédente, un octet par caractère
+  int first_frame;
+  char *buffer;
+  size_t length;
+  size_t capacity;
+} TerminalRenderer;
+
+TerminalRenderer *create_terminal_renderer(Board *board, int braille);
+void destroy_terminal_renderer(TerminalRenderer *renderer);
+int render_terminal(TerminalRenderer *renderer, Board *board);
+
+#endif
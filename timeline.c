@@ -0,0 +1,133 @@
+#include "timeline.h"
+
+static void copy_grid(Board *board, Cell **dest, Cell **src) {
+  for (int i = 0; i < board->rows; i++) {
+    memcpy(dest[i], src[i], board->cols * sizeof(Cell));
+  }
+}
+
+// Enregistre l'état courant du plateau comme image clé
+static void add_keyframe(Timeline *timeline, Board *board) {
+  Cell **cells = pool_acquire_grid(board->pool);
+  if (!cells)
+    return;
+  copy_grid(board, cells, board->cells);
+  timeline->keyframes[timeline->count].generation = board->generation;
+  timeline->keyframes[timeline->count].cells = cells;
+  timeline->count++;
+}
+
+// Abandonne une image clé sur deux (la première est toujours conservée) et
+// double l'intervalle d'enregistrement
+static void thin_keyframes(Timeline *timeline, Board *board) {
+  timeline->interval *= 2;
+  int kept = 1;
+  for (int n = 1; n < timeline->count; n++) {
+    Keyframe keyframe = timeline->keyframes[n];
+    if (keyframe.generation % timeline->interval == 0) {
+      timeline->keyframes[kept++] = keyframe;
+    } else {
+      pool_release_grid(board->pool, keyframe.cells);
+    }
+  }
+  timeline->count = kept;
+}
+
+Timeline *create_timeline(Board *board) {
+  Timeline *timeline = malloc(sizeof(Timeline));
+  if (!timeline)
+    return NULL;
+  timeline->count = 0;
+  timeline->interval = KEYFRAME_INTERVAL;
+  timeline->max_generation = board->generation;
+  add_keyframe(timeline, board);
+  if (timeline->count == 0) {
+    free(timeline);
+    return NULL;
+  }
+  return timeline;
+}
+
+void destroy_timeline(Timeline *timeline, Board *board) {
+  for (int n = 0; n < timeline->count; n++) {
+    pool_release_grid(board->pool, timeline->keyframes[n].cells);
+  }
+  free(timeline);
+}
+
+// A appeler après chaque nouvelle génération calculée
+void timeline_record(Timeline *timeline, Board *board) {
+  if (board->generation > timeline->max_generation)
+    timeline->max_generation = board->generation;
+
+  Keyframe *last = &timeline->keyframes[timeline->count - 1];
+  if (board->generation % timeline->interval != 0 ||
+      board->generation <= last->generation)
+    return;
+
+  if (timeline->count == MAX_KEYFRAMES) {
+    thin_keyframes(timeline, board);
+    if (board->generation % timeline->interval != 0)
+      return;
+  }
+  add_keyframe(timeline, board);
+}
+
+// Image clé la plus récente dont la génération est <= generation
+static Keyframe *find_keyframe(Timeline *timeline, int generation) {
+  int low = 0;
+  int high = timeline->count - 1;
+  while (low < high) {
+    int mid = (low + high + 1) / 2;
+    if (timeline->keyframes[mid].generation <= generation) {
+      low = mid;
+    } else {
+      high = mid - 1;
+    }
+  }
+  return &timeline->keyframes[low];
+}
+
+void timeline_jump(Timeline *timeline, Board *board, int generation) {
+  if (generation < timeline->keyframes[0].generation)
+    generation = timeline->keyframes[0].generation;
+  if (generation - timeline->max_generation > TIMELINE_MAX_LOOKAHEAD)
+    generation = timeline->max_generation + TIMELINE_MAX_LOOKAHEAD;
+
+  // Si la cible est dans l'historique undo/redo, on s'y déplace par simples
+  // échanges de grilles
+  while (board->generation > generation && board->prev &&
+         board->prev->generation >= generation) {
+    undo_generation(board);
+  }
+  while (board->generation < generation && board->next &&
+         board->next->generation <= generation) {
+    redo_generation(board);
+  }
+  if (board->generation == generation)
+    return;
+
+  // Sinon on repart de l'image clé la plus proche, ou de l'état courant s'il
+  // est plus proche de la cible
+  Keyframe *keyframe = find_keyframe(timeline, generation);
+  if (board->generation > generation ||
+      keyframe->generation > board->generation) {
+    copy_grid(board, board->cells, keyframe->cells);
+    board->generation = keyframe->generation;
+  }
+  clear_history(board);
+
+  // Calcul rapide jusqu'à la cible, en s'arrêtant à chaque multiple de
+  // l'intervalle pour enregistrer les images clés au passage. Faute de
+  // mémoire pour le calcul, on s'arrête sur la dernière génération atteinte.
+  while (board->generation < generation) {
+    int steps = generation - board->generation;
+    int to_keyframe =
+        timeline->interval - board->generation % timeline->interval;
+    if (steps > to_keyframe)
+      steps = to_keyframe;
+    if (!advance_board(board, steps))
+      break;
+    timeline_record(timeline, board);
+  }
+}
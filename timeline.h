@@ -0,0 +1,39 @@
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include "gameoflife.h"
+#include "pool.h"
+
+// Une image clé est enregistrée toutes les KEYFRAME_INTERVAL générations.
+// Quand MAX_KEYFRAMES est atteint, une image sur deux est abandonnée et
+// l'intervalle double, la mémoire reste donc bornée quelle que soit la durée.
+#define KEYFRAME_INTERVAL 64
+#define MAX_KEYFRAMES 128
+// Un saut ne calcule pas plus de TIMELINE_MAX_LOOKAHEAD générations au-delà
+// de la plus avancée déjà atteinte : le saut se fait pendant la gestion des
+// événements, une cible démesurée bloquerait la fenêtre. Pour aller plus
+// loin, il suffit de sauter à nouveau.
+#define TIMELINE_MAX_LOOKAHEAD 4096
+
+typedef struct {
+  int generation;
+  Cell **cells; // Grille issue du pool du plateau
+} Keyframe;
+
+// Ligne temporelle : permet de sauter directement à une génération
+// quelconque, en avant par calcul rapide sans historique, en arrière en
+// restaurant l'image clé la plus proche puis en rejouant.
+// Doit être recréée après un resize_board (les grilles changent de pool).
+typedef struct {
+  Keyframe keyframes[MAX_KEYFRAMES]; // Triées par génération croissante
+  int count;
+  int interval;
+  int max_generation; // Génération la plus avancée déjà atteinte
+} Timeline;
+
+Timeline *create_timeline(Board *board);
+void destroy_timeline(Timeline *timeline, Board *board);
+void timeline_record(Timeline *timeline, Board *board);
+void timeline_jump(Timeline *timeline, Board *board, int generation);
+
+#endif
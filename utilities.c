@@ -1,4 +1,9 @@
 #include "utilities.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
 
 // Fonction pour obtenir une entrée valide de l'utilisateur quand il
 // initiatilise le jeu
@@ -32,7 +37,8 @@ char *get_filename() {
     exit(EXIT_FAILURE);
   }
 
-  printf("Entrez le nom du planeur à charger (ex. pulsar): ");
+  printf("Entrez le nom du planeur à charger (ex. pulsar, ou soupe pour un "
+         "remplissage aléatoire): ");
   if (scanf("%511s", filename) != 1) { // Limite la lecture à 511 caractères
     fprintf(stderr, "Erreur : Échec de la lecture du nom du planeur.\n");
     free(filename);
@@ -73,4 +79,13 @@ int create_directory(const char *path) {
 #else
   return system("mkdir -p exports");
 #endif
+}
+
+// Pause portable, utilisée par la boucle du mode terminal (sans SDL)
+void sleep_ms(int milliseconds) {
+#ifdef _WIN32
+  Sleep(milliseconds);
+#else
+  usleep(milliseconds * 1000);
+#endif
 }
\ No newline at end of file
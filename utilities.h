@@ -4,9 +4,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+// Nom à saisir à la place d'un planeur pour un remplissage aléatoire
+#define RANDOM_SOUP_FILE "gliders/soupe.txt"
+
 int get_valid_input(int min, int max, const char *prompt);
 char *get_filename();
 int get_simulation_speed();
 int create_directory(const char *path);
+void sleep_ms(int milliseconds);
 
 #endif
\ No newline at end of file